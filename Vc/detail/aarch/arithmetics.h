@@ -76,6 +76,25 @@ Vc_INTRINSIC x_f32 Vc_VDECL divides(x_f32 a, x_f32 b) { return /*?(a, b)*/; }
 //...
 #endif  // Vc_USE_BUILTIN_VECTOR_TYPES
 
+// add_sat{{{1
+Vc_INTRINSIC int32x4_t Vc_VDECL add_sat(x_i16 a, x_i16 b) { return vreinterpretq_s32_s16(vqaddq_s16(vreinterpretq_s16_s32(a), vreinterpretq_s16_s32(b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL add_sat(x_u16 a, x_u16 b) { return vreinterpretq_s32_u16(vqaddq_u16(vreinterpretq_u16_s32(a), vreinterpretq_u16_s32(b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL add_sat(x_i08 a, x_i08 b) { return vreinterpretq_s32_s8 (vqaddq_s8 (vreinterpretq_s8_s32 (a), vreinterpretq_s8_s32 (b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL add_sat(x_u08 a, x_u08 b) { return vreinterpretq_s32_u8 (vqaddq_u8 (vreinterpretq_u8_s32 (a), vreinterpretq_u8_s32 (b))); }
+
+// sub_sat{{{1
+Vc_INTRINSIC int32x4_t Vc_VDECL sub_sat(x_i16 a, x_i16 b) { return vreinterpretq_s32_s16(vqsubq_s16(vreinterpretq_s16_s32(a), vreinterpretq_s16_s32(b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL sub_sat(x_u16 a, x_u16 b) { return vreinterpretq_s32_u16(vqsubq_u16(vreinterpretq_u16_s32(a), vreinterpretq_u16_s32(b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL sub_sat(x_i08 a, x_i08 b) { return vreinterpretq_s32_s8 (vqsubq_s8 (vreinterpretq_s8_s32 (a), vreinterpretq_s8_s32 (b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL sub_sat(x_u08 a, x_u08 b) { return vreinterpretq_s32_u8 (vqsubq_u8 (vreinterpretq_u8_s32 (a), vreinterpretq_u8_s32 (b))); }
+
+// avg{{{1
+// vrhadd computes (a + b + 1) >> 1 without overflow, for signed and unsigned entries
+Vc_INTRINSIC int32x4_t Vc_VDECL avg(x_i16 a, x_i16 b) { return vreinterpretq_s32_s16(vrhaddq_s16(vreinterpretq_s16_s32(a), vreinterpretq_s16_s32(b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL avg(x_u16 a, x_u16 b) { return vreinterpretq_s32_u16(vrhaddq_u16(vreinterpretq_u16_s32(a), vreinterpretq_u16_s32(b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL avg(x_i08 a, x_i08 b) { return vreinterpretq_s32_s8 (vrhaddq_s8 (vreinterpretq_s8_s32 (a), vreinterpretq_s8_s32 (b))); }
+Vc_INTRINSIC int32x4_t Vc_VDECL avg(x_u08 a, x_u08 b) { return vreinterpretq_s32_u8 (vrhaddq_u8 (vreinterpretq_u8_s32 (a), vreinterpretq_u8_s32 (b))); }
+
 //}}}1
 }  // namespace Vc_VERSIONED_NAMESPACE::detail::aarch
 
@@ -0,0 +1,302 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_DATAPAR_ALGORITHM_H_
+#define VC_DATAPAR_ALGORITHM_H_
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include "synopsis.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// datapar_n {{{1
+template <class T, size_t N> using datapar_n = datapar<T, abi_for_size_t<T, N>>;
+
+// chunk_loop {{{1
+// Splits [0, n) into chunks and calls full(size_constant<N>(), i, flags) for the chunks of N
+// entries and partial(size_constant<K>(), i, flags) for the chunks of K entries (powers of
+// two less than N) before and after them. Thus every entry is visited exactly once, without
+// scalar loops and without accessing memory outside the range. The head is chosen such that
+// the chunks of the range starting at `aligned` are aligned to K * sizeof(T), which flags
+// tells.
+template <size_t K, size_t N, class F, class Flags>
+Vc_INTRINSIC enable_if<(K >= N), void> head_chunks(size_t, size_t &, F &, Flags)
+{
+}
+template <size_t K, size_t N, class F, class Flags>
+Vc_INTRINSIC enable_if<(K < N), void> head_chunks(size_t head, size_t &i, F &partial, Flags f)
+{
+    if (head & K) {
+        partial(size_constant<K>(), i, f);
+        i += K;
+    }
+    head_chunks<2 * K, N>(head, i, partial, f);
+}
+
+template <size_t K, class F, class Flags>
+Vc_INTRINSIC enable_if<(K == 0), void> tail_chunks(size_t, size_t &, F &, Flags)
+{
+}
+template <size_t K, class F, class Flags>
+Vc_INTRINSIC enable_if<(K > 0), void> tail_chunks(size_t rest, size_t &i, F &partial, Flags f)
+{
+    if (rest & K) {
+        partial(size_constant<K>(), i, f);
+        i += K;
+    }
+    tail_chunks<K / 2>(rest, i, partial, f);
+}
+
+template <class T, size_t N, class Full, class Partial>
+Vc_INTRINSIC void chunk_loop(const T *aligned, size_t n, Full &&full, Partial &&partial)
+{
+    const auto addr = reinterpret_cast<std::uintptr_t>(aligned);
+    const size_t head = (N - addr / sizeof(T) % N) % N;
+    size_t i = 0;
+    if (addr % sizeof(T) != 0 || head > n) {
+        for (; i + N <= n; i += N) {
+            full(size_constant<N>(), i, flags::element_aligned);
+        }
+        tail_chunks<N / 2>(n - i, i, partial, flags::element_aligned);
+    } else {
+        head_chunks<1, N>(head, i, partial, flags::vector_aligned);
+        for (; i + N <= n; i += N) {
+            full(size_constant<N>(), i, flags::vector_aligned);
+        }
+        tail_chunks<N / 2>(n - i, i, partial, flags::vector_aligned);
+    }
+}
+
+// store_unless_const {{{1
+template <class V, class T, class F> Vc_INTRINSIC void store_unless_const(const V &x, T *mem, F f)
+{
+    x.memstore(mem, f);
+}
+template <class V, class T, class F> Vc_INTRINSIC void store_unless_const(const V &, const T *, F)
+{
+}
+
+// transform_reduce_chunks {{{1
+// Reduces the datapar objects chunk(size_constant<K>(), i, flags) returns, starting from init
+// if have_init is true. The full chunks are reduced vertically in one register and reduced
+// horizontally only once at the end. n must be positive if have_init is false.
+template <class T, size_t N, class R, class Reduce, class Chunk>
+R transform_reduce_chunks(const T *aligned, size_t n, R init, bool have_init, Reduce &reduce,
+                          Chunk &&chunk)
+{
+    using Acc = std::decay_t<decltype(chunk(size_constant<N>(), size_t(), flags::element_aligned))>;
+    Acc acc = {};
+    bool have_acc = false;
+    R result = init;
+    const auto add_to_result = [&](const auto &x) {
+        const auto r = Vc::reduce(x, reduce);
+        result = have_init ? static_cast<R>(reduce(result, r)) : static_cast<R>(r);
+        have_init = true;
+    };
+    chunk_loop<T, N>(
+        aligned, n,
+        [&](auto k, size_t i, auto f) {
+            if (have_acc) {
+                acc = reduce(acc, chunk(k, i, f));
+            } else {
+                acc = chunk(k, i, f);
+                have_acc = true;
+            }
+        },
+        [&](auto k, size_t i, auto f) { add_to_result(chunk(k, i, f)); });
+    if (have_acc) {
+        add_to_result(acc);
+    }
+    return result;
+}
+//}}}1
+}  // namespace detail
+
+// The following algorithms work on contiguous ranges of arithmetic types and call the given
+// function objects with datapar arguments. The middle of the range is processed in
+// native_datapar chunks. The entries before and after them, which are needed to align the
+// chunks and to finish the range, are processed with datapar types of 2^k entries
+// (abi_for_size_t), never with scalar loops. Therefore the function objects must accept
+// datapar arguments of any size, e.g. generic lambdas.
+
+// for_each {{{1
+// Calls f with datapar objects holding the entries of [first, last). If the range is
+// mutable, the objects are stored back afterwards, such that f can modify them. (non-std)
+template <class ContiguousIterator, class UnaryFunction>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          UnaryFunction>
+for_each(ContiguousIterator first, ContiguousIterator last, UnaryFunction f)
+{
+    using T = typename std::iterator_traits<ContiguousIterator>::value_type;
+    const auto n = last - first;
+    if (n > 0) {
+        auto *const mem = std::addressof(*first);
+        const auto chunk = [&](auto k, size_t i, auto flags) {
+            detail::datapar_n<T, decltype(k)::value> x(mem + i, flags);
+            f(x);
+            detail::store_unless_const(x, mem + i, flags);
+        };
+        detail::chunk_loop<T, native_datapar<T>::size()>(mem, size_t(n), chunk, chunk);
+    }
+    return f;
+}
+
+// transform {{{1
+// Stores op(x) for the datapar objects x holding the entries of [first, last) to the
+// contiguous range starting at out, which may be equal to first, and returns the end of the
+// output range. The stores are aligned. (non-std)
+template <class ContiguousIterator, class ContiguousOutputIterator, class UnaryOperation>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          ContiguousOutputIterator>
+transform(ContiguousIterator first, ContiguousIterator last, ContiguousOutputIterator out,
+          UnaryOperation op)
+{
+    using T = typename std::iterator_traits<ContiguousIterator>::value_type;
+    const auto n = last - first;
+    if (n > 0) {
+        const T *const in = std::addressof(*first);
+        auto *const o = std::addressof(*out);
+        const auto chunk = [&](auto k, size_t i, auto flags) {
+            op(detail::datapar_n<T, decltype(k)::value>(in + i, flags::element_aligned))
+                .memstore(o + i, flags);
+        };
+        detail::chunk_loop<std::remove_pointer_t<decltype(o)>, native_datapar<T>::size()>(
+            o, size_t(n), chunk, chunk);
+    }
+    return out + n;
+}
+
+// Stores op(x, y) for the datapar objects x and y holding the entries of [first1, last1) and
+// the range of equal length starting at first2 to the contiguous range starting at out.
+// (non-std)
+template <class ContiguousIterator1, class ContiguousIterator2, class ContiguousOutputIterator,
+          class BinaryOperation>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator1>::value_type>::value,
+          ContiguousOutputIterator>
+transform(ContiguousIterator1 first1, ContiguousIterator1 last1, ContiguousIterator2 first2,
+          ContiguousOutputIterator out, BinaryOperation op)
+{
+    using T1 = typename std::iterator_traits<ContiguousIterator1>::value_type;
+    using T2 = typename std::iterator_traits<ContiguousIterator2>::value_type;
+    const auto n = last1 - first1;
+    if (n > 0) {
+        const T1 *const in1 = std::addressof(*first1);
+        const T2 *const in2 = std::addressof(*first2);
+        auto *const o = std::addressof(*out);
+        const auto chunk = [&](auto k, size_t i, auto flags) {
+            constexpr size_t K = decltype(k)::value;
+            op(detail::datapar_n<T1, K>(in1 + i, flags::element_aligned),
+               detail::datapar_n<T2, K>(in2 + i, flags::element_aligned))
+                .memstore(o + i, flags);
+        };
+        detail::chunk_loop<std::remove_pointer_t<decltype(o)>, native_datapar<T1>::size()>(
+            o, size_t(n), chunk, chunk);
+    }
+    return out + n;
+}
+
+// transform_reduce {{{1
+// Returns init reduced with transform(x) for the datapar objects x holding the entries of
+// [first, last). reduce is called with datapar and scalar arguments and must be associative
+// and commutative. (non-std)
+template <class ContiguousIterator, class T, class BinaryReductionOp, class UnaryTransformOp>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          T>
+transform_reduce(ContiguousIterator first, ContiguousIterator last, T init,
+                 BinaryReductionOp reduce, UnaryTransformOp transform)
+{
+    using U = typename std::iterator_traits<ContiguousIterator>::value_type;
+    const auto n = last - first;
+    if (n <= 0) {
+        return init;
+    }
+    const U *const in = std::addressof(*first);
+    return detail::transform_reduce_chunks<U, native_datapar<U>::size()>(
+        in, size_t(n), init, true, reduce, [&](auto k, size_t i, auto flags) {
+            return transform(detail::datapar_n<U, decltype(k)::value>(in + i, flags));
+        });
+}
+
+// Returns init reduced with transform(x, y) for the datapar objects x and y holding the
+// entries of [first1, last1) and the range of equal length starting at first2. Without the
+// function objects the result is the inner product. (non-std)
+template <class ContiguousIterator1, class ContiguousIterator2, class T,
+          class BinaryReductionOp, class BinaryTransformOp>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator1>::value_type>::value,
+          T>
+transform_reduce(ContiguousIterator1 first1, ContiguousIterator1 last1,
+                 ContiguousIterator2 first2, T init, BinaryReductionOp reduce,
+                 BinaryTransformOp transform)
+{
+    using U1 = typename std::iterator_traits<ContiguousIterator1>::value_type;
+    using U2 = typename std::iterator_traits<ContiguousIterator2>::value_type;
+    const auto n = last1 - first1;
+    if (n <= 0) {
+        return init;
+    }
+    const U1 *const in1 = std::addressof(*first1);
+    const U2 *const in2 = std::addressof(*first2);
+    return detail::transform_reduce_chunks<U1, native_datapar<U1>::size()>(
+        in1, size_t(n), init, true, reduce, [&](auto k, size_t i, auto flags) {
+            constexpr size_t K = decltype(k)::value;
+            return transform(detail::datapar_n<U1, K>(in1 + i, flags),
+                             detail::datapar_n<U2, K>(in2 + i, flags::element_aligned));
+        });
+}
+
+template <class ContiguousIterator1, class ContiguousIterator2, class T>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator1>::value_type>::value,
+          T>
+transform_reduce(ContiguousIterator1 first1, ContiguousIterator1 last1,
+                 ContiguousIterator2 first2, T init)
+{
+    return Vc::transform_reduce(first1, last1, first2, init, std::plus<>(),
+                                std::multiplies<>());
+}
+
+// reduce {{{1
+// Returns init reduced with the entries of [first, last). binary_op is called with datapar
+// and scalar arguments and must be associative and commutative. (non-std)
+template <class ContiguousIterator, class T, class BinaryOperation = std::plus<>>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          T>
+reduce(ContiguousIterator first, ContiguousIterator last, T init,
+       BinaryOperation binary_op = BinaryOperation())
+{
+    return Vc::transform_reduce(first, last, init, binary_op, [](const auto &x) { return x; });
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_ALGORITHM_H_
+
+// vim: foldmethod=marker
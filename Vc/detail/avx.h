@@ -127,6 +127,30 @@ struct avx_datapar_impl : public generic_datapar_impl<avx_datapar_impl> {
         return detail::load32(mem, f);
     }
 
+    // non-temporal load without conversion{{{3
+    template <class T>
+    static Vc_INTRINSIC intrinsic_type<T> stream_load(const T *mem, type_tag<T>) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(stream_load32(mem));
+    }
+
+    // convert from half / bfloat16 {{{3
+    template <class T, class F>
+    static Vc_INTRINSIC intrinsic_type<T> load(const half *mem, F f, type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "half only converts to float");
+        return x86::half_to_float(size_constant<8>(),
+                                  load16(reinterpret_cast<const ushort *>(mem), f));
+    }
+    template <class T, class F>
+    static Vc_INTRINSIC intrinsic_type<T> load(const bfloat16 *mem, F f,
+                                               type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "bfloat16 only converts to float");
+        return x86::bfloat16_to_float(size_constant<8>(),
+                                      load16(reinterpret_cast<const ushort *>(mem), f));
+    }
+
     // convert from an AVX load{{{3
     template <class T, class U, class F>
     static Vc_INTRINSIC intrinsic_type<T> load(
@@ -227,13 +251,107 @@ struct avx_datapar_impl : public generic_datapar_impl<avx_datapar_impl> {
     static Vc_INTRINSIC void Vc_VDECL masked_load(datapar<T> &merge, mask<T> k,
                                                   const U *mem, F) noexcept
     {
-        // TODO: implement with V(P)MASKMOV if AVX(2) is available
         execute_n_times<size<T>()>([&](auto i) {
             if (k.d.m(i)) {
                 merge.d.set(i, static_cast<T>(mem[i]));
             }
         });
     }
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL masked_load(
+        datapar<T> &merge, mask<T> k, const T *mem, F,
+        enable_if<(sizeof(T) >= maskload_min_entry_size<32>)> = nullarg) noexcept
+    {
+        merge.d = maskload32(merge.d.v(), k.d.v(), mem);
+    }
+
+    // gather {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC datapar_member_type<T> gather(const U *mem,
+                                                      const Vc::datapar<I, IA> &idx,
+                                                      type_tag<T>) noexcept
+    {
+        return generate_from_n_evaluations<size<T>(), datapar_member_type<T>>(
+            [&](auto i) { return static_cast<T>(mem[idx[i]]); });
+    }
+#ifdef Vc_HAVE_AVX2
+    // 32-bit entries with 32-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(
+            _mm256_i32gather_epi32(reinterpret_cast<const int *>(mem), data(idx), 4));
+    }
+
+    // 64-bit entries with 32-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, datapar_abi::sse> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(
+            _mm256_i32gather_epi64(reinterpret_cast<const llong *>(mem), data(idx), 8));
+    }
+
+    // 64-bit entries with 64-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(
+            _mm256_i64gather_epi64(reinterpret_cast<const llong *>(mem), data(idx), 8));
+    }
+#endif  // Vc_HAVE_AVX2
+
+    // masked gather {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(datapar<T> &merge, mask<T> k,
+                                                    const U *mem,
+                                                    const Vc::datapar<I, IA> &idx) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) {
+            if (k.d.m(i)) {
+                merge.d.set(i, static_cast<T>(mem[idx[i]]));
+            }
+        });
+    }
+#ifdef Vc_HAVE_AVX2
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem, const Vc::datapar<I, abi> &idx,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm256_mask_i32gather_epi32(
+            intrin_cast<__m256i>(merge.d.v()), reinterpret_cast<const int *>(mem),
+            data(idx), intrin_cast<__m256i>(k.d.v()), 4));
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem,
+        const Vc::datapar<I, datapar_abi::sse> &idx,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm256_mask_i32gather_epi64(
+            intrin_cast<__m256i>(merge.d.v()), reinterpret_cast<const llong *>(mem),
+            data(idx), intrin_cast<__m256i>(k.d.v()), 8));
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem, const Vc::datapar<I, abi> &idx,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm256_mask_i64gather_epi64(
+            intrin_cast<__m256i>(merge.d.v()), reinterpret_cast<const llong *>(mem),
+            data(idx), intrin_cast<__m256i>(k.d.v()), 8));
+    }
+#endif  // Vc_HAVE_AVX2
 
     // store {{{2
     // store to long double has no vector implementation{{{3
@@ -253,6 +371,32 @@ struct avx_datapar_impl : public generic_datapar_impl<avx_datapar_impl> {
         store32(v, mem, f);
     }
 
+    // non-temporal store without conversion{{{3
+    template <class T>
+    static Vc_INTRINSIC void Vc_VDECL stream_store(datapar_member_type<T> v, T *mem,
+                                                   type_tag<T>) noexcept
+    {
+        stream_store32(v, mem);
+    }
+
+    // convert to half / bfloat16 {{{3
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL store(datapar_member_type<T> v, half *mem, F f,
+                                            type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "half only converts from float");
+        store16(x86::float_to_half(size_constant<8>(), v), reinterpret_cast<ushort *>(mem),
+                f);
+    }
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL store(datapar_member_type<T> v, bfloat16 *mem, F f,
+                                            type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "bfloat16 only converts from float");
+        store16(x86::float_to_bfloat16(size_constant<8>(), v),
+                reinterpret_cast<ushort *>(mem), f);
+    }
+
     // convert and 32-bit store{{{3
     template <class T, class U, class F>
     static Vc_INTRINSIC void Vc_VDECL
@@ -339,13 +483,98 @@ struct avx_datapar_impl : public generic_datapar_impl<avx_datapar_impl> {
     static Vc_INTRINSIC void Vc_VDECL masked_store(datapar<T> v, U *mem, F,
                                                    mask<T> k) noexcept
     {
-        //TODO: detail::masked_store(mem, v.v(), k.d.v(), f);
         execute_n_times<size<T>()>([&](auto i) {
             if (k.d.m(i)) {
                 mem[i] = static_cast<T>(v.d.m(i));
             }
         });
     }
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL masked_store(
+        datapar<T> v, T *mem, F, mask<T> k,
+        enable_if<(sizeof(T) >= maskload_min_entry_size<32>)> = nullarg) noexcept
+    {
+        maskstore32(v.d.v(), k.d.v(), mem);
+    }
+
+    // scatter {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void Vc_VDECL scatter(datapar_member_type<T> v, U *mem,
+                                              const Vc::datapar<I, IA> &idx,
+                                              type_tag<T>) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) { mem[idx[i]] = static_cast<U>(v.m(i)); });
+    }
+#ifdef Vc_HAVE_AVX512VL
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm256_i32scatter_epi32(mem, data(idx), intrin_cast<__m256i>(v.v()), 4);
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, datapar_abi::sse> &idx,
+        type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm256_i32scatter_epi64(mem, data(idx), intrin_cast<__m256i>(v.v()), 8);
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        _mm256_i64scatter_epi64(mem, data(idx), intrin_cast<__m256i>(v.v()), 8);
+    }
+#endif  // Vc_HAVE_AVX512VL
+
+    // masked scatter {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(datapar<T> v, U *mem,
+                                                     const Vc::datapar<I, IA> &idx,
+                                                     mask<T> k) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) {
+            if (k.d.m(i)) {
+                mem[idx[i]] = static_cast<U>(v.d.m(i));
+            }
+        });
+    }
+#ifdef Vc_HAVE_AVX512VL
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, abi> &idx, mask<T> k,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm256_mask_i32scatter_epi32(mem,
+                                     _mm256_movemask_ps(intrin_cast<__m256>(k.d.v())),
+                                     data(idx), intrin_cast<__m256i>(v.d.v()), 4);
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, datapar_abi::sse> &idx, mask<T> k,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm256_mask_i32scatter_epi64(mem,
+                                     _mm256_movemask_pd(intrin_cast<__m256d>(k.d.v())),
+                                     data(idx), intrin_cast<__m256i>(v.d.v()), 8);
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, abi> &idx, mask<T> k,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        _mm256_mask_i64scatter_epi64(mem,
+                                     _mm256_movemask_pd(intrin_cast<__m256d>(k.d.v())),
+                                     data(idx), intrin_cast<__m256i>(v.d.v()), 8);
+    }
+#endif  // Vc_HAVE_AVX512VL
 
     // negation {{{2
     template <class T> static Vc_INTRINSIC mask<T> Vc_VDECL negate(datapar<T> x) noexcept
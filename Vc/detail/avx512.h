@@ -186,6 +186,30 @@ struct avx512_datapar_impl : public generic_datapar_impl<avx512_datapar_impl> {
         return detail::load64(mem, f);
     }
 
+    // non-temporal load without conversion{{{3
+    template <class T>
+    static Vc_INTRINSIC intrinsic_type<T> stream_load(const T *mem, type_tag<T>) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(stream_load64(mem));
+    }
+
+    // convert from half / bfloat16 {{{3
+    template <class T, class F>
+    static Vc_INTRINSIC intrinsic_type<T> load(const half *mem, F f, type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "half only converts to float");
+        return x86::half_to_float(size_constant<16>(),
+                                  load32(reinterpret_cast<const ushort *>(mem), f));
+    }
+    template <class T, class F>
+    static Vc_INTRINSIC intrinsic_type<T> load(const bfloat16 *mem, F f,
+                                               type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "bfloat16 only converts to float");
+        return x86::bfloat16_to_float(size_constant<16>(),
+                                      load32(reinterpret_cast<const ushort *>(mem), f));
+    }
+
     // convert from an AVX512 load{{{3
     template <class T, class U, class F>
     static Vc_INTRINSIC intrinsic_type<T> load(
@@ -261,13 +285,101 @@ struct avx512_datapar_impl : public generic_datapar_impl<avx512_datapar_impl> {
     static Vc_INTRINSIC void masked_load(datapar<T> &merge, mask<T> k, const U *mem,
                                          F) noexcept
     {
-        // TODO
         execute_n_times<size<T>()>([&](auto i) {
             if (k.d.m(i)) {
                 merge.d.set(i, static_cast<T>(mem[i]));
             }
         });
     }
+    template <class T, class F>
+    static Vc_INTRINSIC void masked_load(
+        datapar<T> &merge, mask<T> k, const T *mem, F,
+        enable_if<(sizeof(T) >= maskload_min_entry_size<64>)> = nullarg) noexcept
+    {
+        merge.d = maskload64(merge.d.v(), k.d.v(), mem);
+    }
+
+    // gather {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC datapar_member_type<T> gather(const U *mem,
+                                                      const Vc::datapar<I, IA> &idx,
+                                                      type_tag<T>) noexcept
+    {
+        return generate_from_n_evaluations<size<T>(), datapar_member_type<T>>(
+            [&](auto i) { return static_cast<T>(mem[idx[i]]); });
+    }
+
+    // 32-bit entries with 32-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(_mm512_i32gather_epi32(data(idx), mem, 4));
+    }
+
+#ifdef Vc_HAVE_FULL_AVX_ABI
+    // 64-bit entries with 32-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, datapar_abi::avx> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(_mm512_i32gather_epi64(data(idx), mem, 8));
+    }
+#endif  // Vc_HAVE_FULL_AVX_ABI
+
+    // 64-bit entries with 64-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(_mm512_i64gather_epi64(data(idx), mem, 8));
+    }
+
+    // masked gather {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void masked_gather(datapar<T> &merge, mask<T> k, const U *mem,
+                                           const Vc::datapar<I, IA> &idx) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) {
+            if (k.d.m(i)) {
+                merge.d.set(i, static_cast<T>(mem[idx[i]]));
+            }
+        });
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem, const Vc::datapar<I, abi> &idx,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm512_mask_i32gather_epi32(
+            intrin_cast<__m512i>(merge.d.v()), k.d.v(), data(idx), mem, 4));
+    }
+#ifdef Vc_HAVE_FULL_AVX_ABI
+    template <class T, class I>
+    static Vc_INTRINSIC void masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem,
+        const Vc::datapar<I, datapar_abi::avx> &idx,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm512_mask_i32gather_epi64(
+            intrin_cast<__m512i>(merge.d.v()), k.d.v(), data(idx), mem, 8));
+    }
+#endif  // Vc_HAVE_FULL_AVX_ABI
+    template <class T, class I>
+    static Vc_INTRINSIC void masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem, const Vc::datapar<I, abi> &idx,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm512_mask_i64gather_epi64(
+            intrin_cast<__m512i>(merge.d.v()), k.d.v(), data(idx), mem, 8));
+    }
 
     // store {{{2
     // store to long double has no vector implementation{{{3
@@ -287,6 +399,32 @@ struct avx512_datapar_impl : public generic_datapar_impl<avx512_datapar_impl> {
         store64(v, mem, f);
     }
 
+    // non-temporal store without conversion{{{3
+    template <class T>
+    static Vc_INTRINSIC void stream_store(datapar_member_type<T> v, T *mem,
+                                          type_tag<T>) noexcept
+    {
+        stream_store64(v, mem);
+    }
+
+    // convert to half / bfloat16 {{{3
+    template <class T, class F>
+    static Vc_INTRINSIC void store(datapar_member_type<T> v, half *mem, F f,
+                                   type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "half only converts from float");
+        store32(x86::float_to_half(size_constant<16>(), v), reinterpret_cast<ushort *>(mem),
+                f);
+    }
+    template <class T, class F>
+    static Vc_INTRINSIC void store(datapar_member_type<T> v, bfloat16 *mem, F f,
+                                   type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "bfloat16 only converts from float");
+        store32(x86::float_to_bfloat16(size_constant<16>(), v),
+                reinterpret_cast<ushort *>(mem), f);
+    }
+
     // convert and 64-bit store{{{3
     template <class T, class U, class F>
     static Vc_INTRINSIC void store(
@@ -382,13 +520,94 @@ struct avx512_datapar_impl : public generic_datapar_impl<avx512_datapar_impl> {
     template <class T, class U, class F>
     static Vc_INTRINSIC void masked_store(datapar<T> v, U *mem, F, mask<T> k) noexcept
     {
-        //TODO
         execute_n_times<size<T>()>([&](auto i) {
             if (k.d.m(i)) {
                 mem[i] = static_cast<T>(v.d.m(i));
             }
         });
     }
+    template <class T, class F>
+    static Vc_INTRINSIC void masked_store(
+        datapar<T> v, T *mem, F, mask<T> k,
+        enable_if<(sizeof(T) >= maskload_min_entry_size<64>)> = nullarg) noexcept
+    {
+        maskstore64(v.d.v(), k.d.v(), mem);
+    }
+
+    // scatter {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void scatter(datapar_member_type<T> v, U *mem,
+                                     const Vc::datapar<I, IA> &idx, type_tag<T>) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) { mem[idx[i]] = static_cast<U>(v.m(i)); });
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm512_i32scatter_epi32(mem, data(idx), intrin_cast<__m512i>(v.v()), 4);
+    }
+#ifdef Vc_HAVE_FULL_AVX_ABI
+    template <class T, class I>
+    static Vc_INTRINSIC void scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, datapar_abi::avx> &idx,
+        type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm512_i32scatter_epi64(mem, data(idx), intrin_cast<__m512i>(v.v()), 8);
+    }
+#endif  // Vc_HAVE_FULL_AVX_ABI
+    template <class T, class I>
+    static Vc_INTRINSIC void scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        _mm512_i64scatter_epi64(mem, data(idx), intrin_cast<__m512i>(v.v()), 8);
+    }
+
+    // masked scatter {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void masked_scatter(datapar<T> v, U *mem,
+                                            const Vc::datapar<I, IA> &idx,
+                                            mask<T> k) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) {
+            if (k.d.m(i)) {
+                mem[idx[i]] = static_cast<U>(v.d.m(i));
+            }
+        });
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, abi> &idx, mask<T> k,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm512_mask_i32scatter_epi32(mem, k.d.v(), data(idx),
+                                     intrin_cast<__m512i>(v.d.v()), 4);
+    }
+#ifdef Vc_HAVE_FULL_AVX_ABI
+    template <class T, class I>
+    static Vc_INTRINSIC void masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, datapar_abi::avx> &idx, mask<T> k,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm512_mask_i32scatter_epi64(mem, k.d.v(), data(idx),
+                                     intrin_cast<__m512i>(v.d.v()), 8);
+    }
+#endif  // Vc_HAVE_FULL_AVX_ABI
+    template <class T, class I>
+    static Vc_INTRINSIC void masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, abi> &idx, mask<T> k,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        _mm512_mask_i64scatter_epi64(mem, k.d.v(), data(idx),
+                                     intrin_cast<__m512i>(v.d.v()), 8);
+    }
 
     // negation {{{2
     template <class T> static Vc_INTRINSIC mask<T> negate(datapar<T> x) noexcept
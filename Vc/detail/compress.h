@@ -0,0 +1,460 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_COMPRESS_H_
+#define VC_DATAPAR_COMPRESS_H_
+
+#include <cstdint>
+#include <cstring>
+#include "synopsis.h"
+#include "permute.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// lookup_table {{{1
+// A constant table with the entries F::entry(0), ..., F::entry(N - 1).
+template <class F, size_t... I> struct lookup_table {
+    using value_type = decltype(F::entry(0));
+    alignas(64) static constexpr value_type value[sizeof...(I)] = {F::entry(I)...};
+};
+template <class F, size_t... I>
+alignas(64) constexpr typename lookup_table<F, I...>::value_type
+    lookup_table<F, I...>::value[sizeof...(I)];
+
+template <class F, size_t... I>
+lookup_table<F, I...> make_lookup_table(std::index_sequence<I...>);
+template <class F, size_t N>
+using lookup_table_t = decltype(make_lookup_table<F>(std::make_index_sequence<N>()));
+
+// compress tables {{{1
+// The tables are indexed with the movemask bits of 32-bit lanes. 64-bit entries therefore
+// occupy two adjacent lanes, with both bits equal.
+
+// Returns the index of the lane that holds the r-th set bit of m, or -1.
+constexpr int nth_set_bit(size_t m, int r)
+{
+    for (int i = 0; m != 0; ++i, m >>= 1) {
+        if ((m & 1) && r-- == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Returns the number of set bits of m below bit i.
+constexpr int popcount_below(size_t m, int i)
+{
+    return i == 0 ? 0 : int(m & 1) + popcount_below(m >> 1, i - 1);
+}
+
+// Entry m holds the source lane of destination lane r in the bits [4r, 4r + 4), as needed
+// by vpermd after a variable shift.
+struct compress_nibbles {
+    static constexpr uint entry(size_t m)
+    {
+        uint r = 0;
+        for (int i = 0; i < 8 && nth_set_bit(m, i) >= 0; ++i) {
+            r |= uint(nth_set_bit(m, i)) << (4 * i);
+        }
+        return r;
+    }
+};
+
+// Entry m holds the source lane of destination lane i in the bits [4i, 4i + 4). Lanes that
+// are not selected keep their value, thus their index does not matter.
+struct expand_nibbles {
+    static constexpr uint entry(size_t m)
+    {
+        uint r = 0;
+        for (int i = 0; i < 8; ++i) {
+            r |= ((m >> i) & 1) ? uint(popcount_below(m, i)) << (4 * i) : 0u;
+        }
+        return r;
+    }
+};
+
+// pshufb control for four 32-bit lanes, split into two 64-bit halves: entry 2m + h is
+// half h for mask m. Bytes with no source lane are 0x80 and thus zeroed.
+struct compress_bytes {
+    static constexpr ullong entry(size_t mh)
+    {
+        ullong r = 0;
+        for (int b = 0; b < 8; ++b) {
+            const int lane = nth_set_bit(mh / 2, int(mh % 2) * 2 + b / 4);
+            r |= ullong(lane < 0 ? 0x80 : lane * 4 + b % 4) << (8 * b);
+        }
+        return r;
+    }
+};
+
+struct expand_bytes {
+    static constexpr ullong entry(size_t mh)
+    {
+        ullong r = 0;
+        for (int b = 0; b < 8; ++b) {
+            const int lane = int(mh % 2) * 2 + b / 4;
+            const bool selected = (mh / 2 >> lane) & 1;
+            r |= ullong(selected ? popcount_below(mh / 2, lane) * 4 + b % 4 : 0x80) << (8 * b);
+        }
+        return r;
+    }
+};
+
+#ifdef Vc_HAVE_SSE2
+namespace x86
+{
+// prefix_bits {{{1
+// A bitmask of the lowest n of N bits.
+template <size_t N> Vc_INTRINSIC ullong prefix_bits(size_t n)
+{
+    return N < 64 || n < 64 ? (1ull << n) - 1 : ~0ull;
+}
+
+#ifdef Vc_HAVE_SSSE3
+// store_prefix / load_prefix {{{1
+// Stores (loads) the lowest n 32-bit lanes. The memory beyond is not accessed. When
+// filtering data n is hardly predictable, thus the store does not branch on n. Instead it
+// always stores three pieces and redirects the ones that must not be written to a scratch
+// buffer. The address is selected with integer arithmetic, since compilers turn a
+// conditional expression into a branch.
+Vc_INTRINSIC char *select_address(bool c, char *a, char *b)
+{
+    const auto ia = reinterpret_cast<std::uintptr_t>(a);
+    const auto ib = reinterpret_cast<std::uintptr_t>(b);
+    return reinterpret_cast<char *>(ib ^ ((ia ^ ib) & (std::uintptr_t(0) - c)));
+}
+
+Vc_INTRINSIC void store_prefix(__m128i v, int n, void *mem)
+{
+    alignas(16) int lanes[4];
+    alignas(16) char scratch[16];
+    char *addr = static_cast<char *>(mem);
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), v);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(select_address(n == 4, addr, scratch)), v);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(select_address(n & 2, addr, scratch)), v);
+    std::memcpy(select_address(n & 1, addr + 4 * (n & 2), scratch), &lanes[n & 2], 4);
+}
+
+Vc_INTRINSIC __m128i load_prefix(const void *mem, int n)
+{
+    const char *addr = static_cast<const char *>(mem);
+    if (n == 4) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(addr));
+    }
+    __m128i r = _mm_setzero_si128();
+    if (n & 1) {
+        int x;
+        std::memcpy(&x, addr + 4 * (n & 2), 4);
+        r = _mm_cvtsi32_si128(x);
+    }
+    if (n & 2) {
+        r = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(addr)), r);
+    }
+    return r;
+}
+
+// compress_store / expand_load (__m128i) {{{1
+// m are the movemask bits of 32-bit lanes; the functions return the number of 32-bit lanes.
+Vc_INTRINSIC int compress_store(__m128i v, int m, void *mem)
+{
+    using lut = lookup_table_t<compress_bytes, 32>;
+    const __m128i c = _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(&lut::value[2 * m])));
+    const int n = popcnt4(m);
+    store_prefix(c, n, mem);
+    return n;
+}
+
+Vc_INTRINSIC int expand_load(const void *mem, int m, __m128i k, __m128i &v)
+{
+    using lut = lookup_table_t<expand_bytes, 32>;
+    const int n = popcnt4(m);
+    const __m128i e = _mm_shuffle_epi8(
+        load_prefix(mem, n),
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&lut::value[2 * m])));
+    v = or_(and_(k, e), andnot_(k, v));
+    return n;
+}
+#endif  // Vc_HAVE_SSSE3
+
+#ifdef Vc_HAVE_AVX2
+// compress_store / expand_load (__m256i) {{{1
+Vc_INTRINSIC __m256i lanes_below(int n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+Vc_INTRINSIC __m256i unpack_nibbles(uint x)
+{
+    // vpermd only reads the low three bits of every index
+    return _mm256_srlv_epi32(_mm256_set1_epi32(x),
+                             _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+}
+
+Vc_INTRINSIC int compress_store(__m256i v, int m, void *mem)
+{
+    using lut = lookup_table_t<compress_nibbles, 256>;
+    const __m256i c = _mm256_permutevar8x32_epi32(v, unpack_nibbles(lut::value[m]));
+    const int n = popcnt8(m);
+    _mm256_maskstore_epi32(static_cast<int *>(mem), lanes_below(n), c);
+    return n;
+}
+
+Vc_INTRINSIC int expand_load(const void *mem, int m, __m256i k, __m256i &v)
+{
+    using lut = lookup_table_t<expand_nibbles, 256>;
+    const int n = popcnt8(m);
+    const __m256i e = _mm256_permutevar8x32_epi32(
+        _mm256_maskload_epi32(static_cast<const int *>(mem), lanes_below(n)),
+        unpack_nibbles(lut::value[m]));
+    v = _mm256_blendv_epi8(v, e, k);
+    return n;
+}
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+// compress / expand {{{1
+// Entries of E bytes; k selects the entries.
+Vc_INTRINSIC __m512i compress(size_constant<4>, __m512i v, ullong k)
+{
+    return _mm512_maskz_compress_epi32(k, v);
+}
+Vc_INTRINSIC __m512i compress(size_constant<8>, __m512i v, ullong k)
+{
+    return _mm512_maskz_compress_epi64(k, v);
+}
+Vc_INTRINSIC __m512i expand(size_constant<4>, __m512i v, ullong k, __m512i e)
+{
+    return _mm512_mask_expand_epi32(v, k, e);
+}
+Vc_INTRINSIC __m512i expand(size_constant<8>, __m512i v, ullong k, __m512i e)
+{
+    return _mm512_mask_expand_epi64(v, k, e);
+}
+Vc_INTRINSIC void store_prefix(size_constant<4>, __m512i v, ullong k, void *mem)
+{
+    _mm512_mask_storeu_epi32(mem, k, v);
+}
+Vc_INTRINSIC void store_prefix(size_constant<8>, __m512i v, ullong k, void *mem)
+{
+    _mm512_mask_storeu_epi64(mem, k, v);
+}
+Vc_INTRINSIC __m512i load_prefix(size_constant<4>, ullong k, const void *mem)
+{
+    return _mm512_maskz_loadu_epi32(k, mem);
+}
+Vc_INTRINSIC __m512i load_prefix(size_constant<8>, ullong k, const void *mem)
+{
+    return _mm512_maskz_loadu_epi64(k, mem);
+}
+#ifdef Vc_HAVE_AVX512VBMI2
+Vc_INTRINSIC __m512i compress(size_constant<1>, __m512i v, ullong k)
+{
+    return _mm512_maskz_compress_epi8(k, v);
+}
+Vc_INTRINSIC __m512i compress(size_constant<2>, __m512i v, ullong k)
+{
+    return _mm512_maskz_compress_epi16(k, v);
+}
+Vc_INTRINSIC __m512i expand(size_constant<1>, __m512i v, ullong k, __m512i e)
+{
+    return _mm512_mask_expand_epi8(v, k, e);
+}
+Vc_INTRINSIC __m512i expand(size_constant<2>, __m512i v, ullong k, __m512i e)
+{
+    return _mm512_mask_expand_epi16(v, k, e);
+}
+Vc_INTRINSIC void store_prefix(size_constant<1>, __m512i v, ullong k, void *mem)
+{
+    _mm512_mask_storeu_epi8(mem, k, v);
+}
+Vc_INTRINSIC void store_prefix(size_constant<2>, __m512i v, ullong k, void *mem)
+{
+    _mm512_mask_storeu_epi16(mem, k, v);
+}
+Vc_INTRINSIC __m512i load_prefix(size_constant<1>, ullong k, const void *mem)
+{
+    return _mm512_maskz_loadu_epi8(k, mem);
+}
+Vc_INTRINSIC __m512i load_prefix(size_constant<2>, ullong k, const void *mem)
+{
+    return _mm512_maskz_loadu_epi16(k, mem);
+}
+#endif  // Vc_HAVE_AVX512VBMI2
+#endif  // Vc_HAVE_AVX512F
+//}}}1
+}  // namespace x86
+#endif  // Vc_HAVE_SSE2
+
+// compress_impl / expand_impl {{{1
+// The generic case copies the entries one by one.
+template <class T, class A>
+Vc_INTRINSIC size_t compress_impl(const datapar<T, A> &x, const mask<T, A> &k, T *mem)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        if (k[i]) {
+            mem[n++] = x[i];
+        }
+    }
+    return n;
+}
+
+template <class T, class A>
+Vc_INTRINSIC size_t expand_impl(const T *mem, const mask<T, A> &k, datapar<T, A> &x)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        if (k[i]) {
+            x[i] = mem[n++];
+        }
+    }
+    return n;
+}
+
+// The SSE and AVX implementations work on 32-bit lanes, where every entry with 8 bytes
+// occupies two lanes.
+#if defined Vc_HAVE_SSE_ABI && defined Vc_HAVE_SSSE3
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), size_t> compress_impl(
+    const datapar<T, datapar_abi::sse> &x, const mask<T, datapar_abi::sse> &k, T *mem)
+{
+    const auto kv =
+        static_cast<typename detail::traits<T, datapar_abi::sse>::mask_cast_type>(k);
+    return x86::compress_store(x86::intrin_cast<__m128i>(data(x).v()),
+                               _mm_movemask_ps(x86::intrin_cast<__m128>(kv)), mem) /
+           (sizeof(T) / 4);
+}
+
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), size_t> expand_impl(
+    const T *mem, const mask<T, datapar_abi::sse> &k, datapar<T, datapar_abi::sse> &x)
+{
+    using V = datapar<T, datapar_abi::sse>;
+    const auto kv =
+        static_cast<typename detail::traits<T, datapar_abi::sse>::mask_cast_type>(k);
+    __m128i v = x86::intrin_cast<__m128i>(data(x).v());
+    const int n = x86::expand_load(mem, _mm_movemask_ps(x86::intrin_cast<__m128>(kv)),
+                                   x86::intrin_cast<__m128i>(kv), v);
+    x = V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(v));
+    return n / (sizeof(T) / 4);
+}
+#endif  // Vc_HAVE_SSE_ABI && Vc_HAVE_SSSE3
+
+#if defined Vc_HAVE_AVX_ABI && defined Vc_HAVE_AVX2
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), size_t> compress_impl(
+    const datapar<T, datapar_abi::avx> &x, const mask<T, datapar_abi::avx> &k, T *mem)
+{
+    const auto kv =
+        static_cast<typename detail::traits<T, datapar_abi::avx>::mask_cast_type>(k);
+    return x86::compress_store(x86::intrin_cast<__m256i>(data(x).v()),
+                               _mm256_movemask_ps(x86::intrin_cast<__m256>(kv)), mem) /
+           (sizeof(T) / 4);
+}
+
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), size_t> expand_impl(
+    const T *mem, const mask<T, datapar_abi::avx> &k, datapar<T, datapar_abi::avx> &x)
+{
+    using V = datapar<T, datapar_abi::avx>;
+    const auto kv =
+        static_cast<typename detail::traits<T, datapar_abi::avx>::mask_cast_type>(k);
+    __m256i v = x86::intrin_cast<__m256i>(data(x).v());
+    const int n = x86::expand_load(mem, _mm256_movemask_ps(x86::intrin_cast<__m256>(kv)),
+                                   x86::intrin_cast<__m256i>(kv), v);
+    x = V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(v));
+    return n / (sizeof(T) / 4);
+}
+#endif  // Vc_HAVE_AVX_ABI && Vc_HAVE_AVX2
+
+// On AVX-512 vpcompress and vpexpand do the work; the masked store (load) of the prefix
+// avoids the slow memory forms of the instructions.
+#ifdef Vc_HAVE_AVX512_ABI
+#ifdef Vc_HAVE_AVX512VBMI2
+template <class T> using native_compress = enable_if<(sizeof(T) <= 8), size_t>;
+#else   // Vc_HAVE_AVX512VBMI2
+template <class T> using native_compress = enable_if<(sizeof(T) >= 4 && sizeof(T) <= 8), size_t>;
+#endif  // Vc_HAVE_AVX512VBMI2
+
+template <class T>
+Vc_INTRINSIC native_compress<T> compress_impl(const datapar<T, datapar_abi::avx512> &x,
+                                              const mask<T, datapar_abi::avx512> &k, T *mem)
+{
+    constexpr size_t N = datapar_size_v<T, datapar_abi::avx512>;
+    const ullong bits = data(k);
+    const size_t n = popcount(k);
+    x86::store_prefix(size_tag<sizeof(T)>,
+                      x86::compress(size_tag<sizeof(T)>,
+                                    x86::intrin_cast<__m512i>(data(x).v()), bits),
+                      x86::prefix_bits<N>(n), mem);
+    return n;
+}
+
+template <class T>
+Vc_INTRINSIC native_compress<T> expand_impl(const T *mem,
+                                            const mask<T, datapar_abi::avx512> &k,
+                                            datapar<T, datapar_abi::avx512> &x)
+{
+    using V = datapar<T, datapar_abi::avx512>;
+    const ullong bits = data(k);
+    const size_t n = popcount(k);
+    x = V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(x86::expand(
+        size_tag<sizeof(T)>, x86::intrin_cast<__m512i>(data(x).v()), bits,
+        x86::load_prefix(size_tag<sizeof(T)>, x86::prefix_bits<V::size()>(n), mem))));
+    return n;
+}
+#endif  // Vc_HAVE_AVX512_ABI
+//}}}1
+}  // namespace detail
+
+// compress_store {{{1
+// Stores the entries of x selected by k consecutively to mem and returns their number.
+// Nothing is written to mem[popcount(k)] and beyond, thus a filter loop advances mem by
+// the return value. mem needs no particular alignment. (non-std)
+template <class T, class A>
+Vc_INTRINSIC size_t compress_store(const datapar<T, A> &x, const mask<T, A> &k, T *mem)
+{
+    return detail::compress_impl(x, k, mem);
+}
+
+// expand_load {{{1
+// The inverse of compress_store: assigns consecutive values from mem to the entries of x
+// selected by k, in order, and returns their number. The other entries of x keep their
+// value and nothing is read from mem[popcount(k)] and beyond. (non-std)
+template <class T, class A>
+Vc_INTRINSIC size_t expand_load(const T *mem, const mask<T, A> &k, datapar<T, A> &x)
+{
+    return detail::expand_impl(mem, k, x);
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_COMPRESS_H_
+
+// vim: foldmethod=marker
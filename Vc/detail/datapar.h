@@ -101,6 +101,8 @@ public:
     friend V &operator ^=(V &lhs, const V &x) { return lhs = lhs  ^ x; }
     friend V &operator<<=(V &lhs, const V &x) { return lhs = lhs << x; }
     friend V &operator>>=(V &lhs, const V &x) { return lhs = lhs >> x; }
+    friend V &operator<<=(V &lhs, int x) { return lhs = lhs << x; }
+    friend V &operator>>=(V &lhs, int x) { return lhs = lhs >> x; }
 
     friend V operator%(const V &x, const V &y) { return impl::modulus(x, y); }
     friend V operator&(const V &x, const V &y) { return impl::bit_and(x, y); }
@@ -108,6 +110,8 @@ public:
     friend V operator^(const V &x, const V &y) { return impl::bit_xor(x, y); }
     friend V operator<<(const V &x, const V &y) { return impl::bit_shift_left(x, y); }
     friend V operator>>(const V &x, const V &y) { return impl::bit_shift_right(x, y); }
+    friend V operator<<(const V &x, int y) { return impl::bit_shift_left(x, y); }
+    friend V operator>>(const V &x, int y) { return impl::bit_shift_right(x, y); }
 };
 
 template <class T, class Abi>
@@ -162,9 +166,8 @@ public:
                         negation<detail::is_narrowing_conversion<U, value_type>>,
                         detail::converts_to_higher_integer_rank<U, value_type>>::value,
             void *> = nullptr)
-        : datapar{static_cast<const std::array<U, size()> &>(x).data(),
-                  flags::vector_aligned}
     {
+        convert_from_fixed_size(x);
     }
 
     // explicit type conversion constructor
@@ -178,9 +181,8 @@ public:
                                     std::is_convertible<U, value_type>>,
                         detail::is_narrowing_conversion<U, value_type>>::value,
             void *> = nullptr)
-        : datapar{static_cast<const std::array<U, size()> &>(x).data(),
-                  flags::vector_aligned}
     {
+        convert_from_fixed_size(x);
     }
 
     // 2nd conversion ctor: convert equal Abi, integers that only differ in signedness
@@ -201,7 +203,9 @@ public:
         std::enable_if_t<detail::allow_conversion_ctor3<value_type, Abi, U, Abi2>::value,
                          void *> = nullptr)
     {
-        x.memstore(d.data(), flags::overaligned<alignof(datapar)>);
+        alignas(memory_alignment<datapar>::value) value_type mem[size()];
+        x.memstore(mem, flags::vector_aligned);
+        memload(mem, flags::vector_aligned);
     }
 
     // generator constructor
@@ -232,20 +236,47 @@ public:
     // load constructor
     template <class U, class Flags>
     datapar(const U *mem, Flags f)
-        : d(impl::load(mem, f, type_tag))
+        : d(load_impl(mem, detail::prefetch_hint<false>(mem, f)))
     {
     }
 
+    // gather constructor (non-std)
+    template <class U, class I, class IA>
+    datapar(const U *mem, const datapar<I, IA> &indexes)
+        : d(impl::gather(mem, indexes, type_tag))
+    {
+        static_assert(std::is_integral<I>::value && datapar<I, IA>::size() == size(),
+                      "gathers require an integral index vector of equal size");
+    }
+
     // loads [datapar.load]
     template <class U, class Flags> void memload(const U *mem, Flags f)
     {
-        d = static_cast<decltype(d)>(impl::load(mem, f, type_tag));
+        d = static_cast<decltype(d)>(load_impl(mem, detail::prefetch_hint<false>(mem, f)));
+    }
+
+    // gathers (non-std)
+    template <class U, class I, class IA>
+    void gather(const U *mem, const datapar<I, IA> &indexes)
+    {
+        static_assert(std::is_integral<I>::value && datapar<I, IA>::size() == size(),
+                      "gathers require an integral index vector of equal size");
+        d = static_cast<decltype(d)>(impl::gather(mem, indexes, type_tag));
     }
 
     // stores [datapar.store]
     template <class U, class Flags> void memstore(U *mem, Flags f) const
     {
-        impl::store(d, mem, f, type_tag);
+        store_impl(mem, detail::prefetch_hint<true>(mem, f));
+    }
+
+    // scatters (non-std)
+    template <class U, class I, class IA>
+    void scatter(U *mem, const datapar<I, IA> &indexes) const
+    {
+        static_assert(std::is_integral<I>::value && datapar<I, IA>::size() == size(),
+                      "scatters require an integral index vector of equal size");
+        impl::scatter(d, mem, indexes, type_tag);
     }
 
     // scalar access
@@ -329,6 +360,59 @@ private:
     friend auto detail::data<value_type, abi_type>(const datapar &);
 #endif
     datapar(detail::private_init_t, const member_type &init) : d(init) {}
+
+    // Streaming loads and stores use the non-temporal instructions of the ABI if it has
+    // them for value_type, and vector-aligned loads and stores otherwise (e.g. with
+    // conversions).
+    template <class U, class F> static Vc_INTRINSIC auto load_impl(const U *mem, F f)
+    {
+        return impl::load(mem, f, type_tag);
+    }
+    template <class U>
+    static Vc_INTRINSIC auto load_impl(const U *mem, flags::streaming_tag)
+    {
+        return stream_load_impl(mem, 0);
+    }
+    template <class U, class I = impl>
+    static Vc_INTRINSIC auto stream_load_impl(const U *mem, int)
+        -> decltype(I::stream_load(mem, type_tag))
+    {
+        return I::stream_load(mem, type_tag);
+    }
+    template <class U> static Vc_INTRINSIC auto stream_load_impl(const U *mem, float)
+    {
+        return impl::load(mem, flags::vector_aligned, type_tag);
+    }
+
+    template <class U, class F> Vc_INTRINSIC void store_impl(U *mem, F f) const
+    {
+        impl::store(d, mem, f, type_tag);
+    }
+    template <class U> Vc_INTRINSIC void store_impl(U *mem, flags::streaming_tag) const
+    {
+        stream_store_impl(mem, 0);
+    }
+    template <class U, class I = impl>
+    Vc_INTRINSIC auto stream_store_impl(U *mem, int) const
+        -> decltype(I::stream_store(declval<const member_type &>(), mem, type_tag))
+    {
+        I::stream_store(d, mem, type_tag);
+    }
+    template <class U> Vc_INTRINSIC void stream_store_impl(U *mem, float) const
+    {
+        impl::store(d, mem, flags::vector_aligned, type_tag);
+    }
+
+    // The member types of fixed_size objects differ for different value types, thus
+    // conversions go through memory.
+    template <class U>
+    void convert_from_fixed_size(const datapar<U, datapar_abi::fixed_size<size_v>> &x)
+    {
+        alignas(memory_alignment<datapar, U>::value) U mem[size()];
+        x.memstore(mem, flags::vector_aligned);
+        memload(mem, flags::vector_aligned);
+    }
+
     alignas(traits::datapar_member_alignment) member_type d = {};
 };
 
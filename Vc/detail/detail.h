@@ -28,11 +28,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_DATAPAR_DETAIL_H_
 #define VC_DATAPAR_DETAIL_H_
 
+#include <cstdint>
 #include <limits>
 #include <functional>
 #include "macros.h"
 #include "flags.h"
 #include "type_traits.h"
+#ifdef Vc_HAVE_SSE
+#include <xmmintrin.h>
+#endif
 
 Vc_VERSIONED_NAMESPACE_BEGIN
 namespace detail
@@ -75,6 +79,79 @@ static Vc_INTRINSIC unsigned int promote_preserving_unsigned(const unsigned shor
     return x;
 }
 
+// mulhi{{{1
+/**
+ * \internal
+ * Returns the upper half of the double-width product of \p a and \p b.
+ */
+template <class T>
+constexpr enable_if<(sizeof(T) < sizeof(llong)), T> mulhi(T a, T b)
+{
+    using W = std::conditional_t<std::is_signed<T>::value, llong, ullong>;
+    return static_cast<T>((W(a) * W(b)) >>
+                          std::numeric_limits<std::make_unsigned_t<T>>::digits);
+}
+
+template <class T>
+constexpr enable_if<(sizeof(T) == sizeof(ullong) && std::is_unsigned<T>::value), T>
+mulhi(T a, T b)
+{
+    // schoolbook multiplication with 32-bit digits
+    const ullong a_lo = a & 0xffffffffu, a_hi = a >> 32;
+    const ullong b_lo = b & 0xffffffffu, b_hi = b >> 32;
+    const ullong lh = a_lo * b_hi;
+    const ullong hl = a_hi * b_lo;
+    const ullong mid = ((a_lo * b_lo) >> 32) + (lh & 0xffffffffu) + (hl & 0xffffffffu);
+    return a_hi * b_hi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+
+template <class T>
+constexpr enable_if<(sizeof(T) == sizeof(ullong) && std::is_signed<T>::value), T>
+mulhi(T a, T b)
+{
+    // the signed product differs from the unsigned one by b * 2⁶⁴ if a < 0 and by
+    // a * 2⁶⁴ if b < 0
+    return static_cast<T>(mulhi(ullong(a), ullong(b)) - (a < 0 ? ullong(b) : 0) -
+                          (b < 0 ? ullong(a) : 0));
+}
+
+// saturate{{{1
+/**
+ * \internal
+ * Returns \p x clamped to the range of the integral type \p T.
+ */
+template <class T, class U> constexpr T saturate(U x)
+{
+    return std::is_signed<U>::value && llong(x) < 0
+               ? (llong(x) < llong(std::numeric_limits<T>::min())
+                      ? std::numeric_limits<T>::min()
+                      : static_cast<T>(x))
+               : (ullong(x) > ullong(std::numeric_limits<T>::max())
+                      ? std::numeric_limits<T>::max()
+                      : static_cast<T>(x));
+}
+
+// add_sat, sub_sat, avg{{{1
+/**
+ * \internal
+ * Saturating addition and subtraction and the average rounded up, for integers narrower
+ * than int. The promotion to int makes all intermediate results exact.
+ */
+template <class T>
+using narrow_int = enable_if<std::is_integral<T>::value && (sizeof(T) < sizeof(int)), T>;
+template <class T> constexpr narrow_int<T> add_sat(T a, T b)
+{
+    return saturate<T>(int(a) + int(b));
+}
+template <class T> constexpr narrow_int<T> sub_sat(T a, T b)
+{
+    return saturate<T>(int(a) - int(b));
+}
+template <class T> constexpr narrow_int<T> avg(T a, T b)
+{
+    return static_cast<T>((int(a) + int(b) + 1) >> 1);
+}
+
 // exact_bool{{{1
 class exact_bool {
     const bool d;
@@ -183,8 +260,9 @@ template <class T, class X> struct default_neutral_element<T, std::bit_xor<X>> {
  */
 static constexpr struct private_init_t {} private_init = {};
 
-// size_tag{{{1
+// size_tag / size_constant{{{1
 template <size_t N> static constexpr std::integral_constant<size_t, N> size_tag = {};
+template <size_t N> using size_constant = std::integral_constant<size_t, N>;
 
 // identity/id{{{1
 template <class T> struct identity {
@@ -278,8 +356,46 @@ public:
     }
 };
 
+// prefetch{{{1
+// Prefetches the cache line of p into cache level Level, or non-temporally for Level 0.
+template <int Level, bool Write = false> Vc_INTRINSIC void prefetch(const void *p)
+{
+#if defined Vc_GCC || defined Vc_CLANG || defined Vc_ICC
+    __builtin_prefetch(p, Write, Level == 0 ? 0 : 4 - Level);
+#elif defined Vc_HAVE_SSE
+    _mm_prefetch(static_cast<const char *>(p), Level == 0 ? _MM_HINT_NTA
+                                               : Level == 1 ? _MM_HINT_T0
+                                               : Level == 2 ? _MM_HINT_T1
+                                                            : _MM_HINT_T2);
+#else
+    unused(p);
+#endif
+}
+
+// prefetch_hint{{{1
+// Issues the prefetch a load/store flag asks for and returns the flag for the memory access
+// itself.
+template <bool Write, class F> Vc_INTRINSIC F prefetch_hint(const void *, F f) { return f; }
+template <bool Write, size_t Distance, int Level, class F>
+Vc_INTRINSIC F prefetch_hint(const void *mem, flags::prefetch_tag<Distance, Level, F>)
+{
+    prefetch<Level, Write>(
+        reinterpret_cast<const void *>(reinterpret_cast<std::uintptr_t>(mem) + Distance));
+    return {};
+}
+
 //}}}1
 }  // namespace detail
+
+// streaming_fence{{{1
+// Orders all preceding streaming stores before the following stores. (non-std)
+inline void streaming_fence()
+{
+#ifdef Vc_HAVE_SSE
+    _mm_sfence();
+#endif
+}
+//}}}1
 Vc_VERSIONED_NAMESPACE_END
 #endif  // VC_DATAPAR_DETAIL_H_
 
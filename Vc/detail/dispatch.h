@@ -0,0 +1,202 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_DATAPAR_DISPATCH_H_
+#define VC_DATAPAR_DISPATCH_H_
+
+#include <atomic>
+#include <cstdlib>
+#include <utility>
+#include "macros.h"
+
+// dispatch_target and dispatched are shared by the copies of a source compiled for the
+// different targets, everything else is specific to the target of the copy (see version.h).
+Vc_DISPATCH_SHARED_NAMESPACE_BEGIN
+// dispatch_target {{{1
+// The instruction set levels a kernel can be compiled for and dispatched to at runtime.
+// Every level implies the ones before it. The levels correspond to the compiler flags
+// -msse2, -msse4.2, -mavx, "-mavx2 -mfma -mbmi -mbmi2", and -march=skylake-avx512.
+// (non-std)
+enum class dispatch_target : int { scalar, sse2, sse4_2, avx, avx2, avx512 };
+Vc_DISPATCH_SHARED_NAMESPACE_END
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+// The lowest dispatch_target that implies every instruction set extension the current
+// translation unit is compiled for. (non-std)
+constexpr dispatch_target current_dispatch_target =
+#if defined Vc_HAVE_AVX512F
+    dispatch_target::avx512;
+#elif defined Vc_HAVE_AVX2 || defined Vc_HAVE_FMA || defined Vc_HAVE_F16C ||              \
+    defined Vc_HAVE_BMI2
+    dispatch_target::avx2;
+#elif defined Vc_HAVE_AVX
+    dispatch_target::avx;
+#elif defined Vc_HAVE_SSE3 || defined Vc_HAVE_SSSE3 || defined Vc_HAVE_SSE4_1 ||          \
+    defined Vc_HAVE_SSE4_2
+    dispatch_target::sse4_2;
+#elif defined Vc_HAVE_SSE2
+    dispatch_target::sse2;
+#else
+    dispatch_target::scalar;
+#endif
+
+// best_dispatch_target {{{1
+namespace detail
+{
+inline dispatch_target detect_dispatch_target()
+{
+#if (defined Vc_GCC || defined Vc_CLANG || defined Vc_ICC) &&                              \
+    (defined __x86_64__ || defined __i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+        __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+        return dispatch_target::avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+        __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2")) {
+        return dispatch_target::avx2;
+    }
+    if (__builtin_cpu_supports("avx")) {
+        return dispatch_target::avx;
+    }
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+        return dispatch_target::sse4_2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return dispatch_target::sse2;
+    }
+    return dispatch_target::scalar;
+#else
+    // Without a way to query the CPU the target the caller was compiled for is the best
+    // one known to work.
+    return current_dispatch_target;
+#endif
+}
+}  // namespace detail
+
+// Returns the highest dispatch_target the CPU executing the program supports. The CPU is
+// queried only on the first call. The template parameter keeps the copies compiled for
+// different targets apart; don't specify it. (non-std)
+template <dispatch_target Caller = current_dispatch_target>
+dispatch_target best_dispatch_target()
+{
+    static const dispatch_target best = detail::detect_dispatch_target();
+    return best;
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+Vc_DISPATCH_SHARED_NAMESPACE_BEGIN
+
+// dispatched {{{1
+// A function with one implementation per dispatch_target, compiled from the same datapar
+// source, that calls the best implementation the CPU supports. (non-std)
+//
+// Define the object once, in a translation unit compiled for the baseline target:
+//     Vc::dispatched<void(float, const float *, float *, std::size_t)> saxpy;
+// Compile the kernel once per target (vc_compile_for_dispatch in VcMacros.cmake) and
+// register it during static initialization. The kernel must have internal linkage:
+//     namespace {
+//     void saxpy_impl(float a, const float *x, float *y, std::size_t n) { ... }
+//     }
+//     static const bool saxpy_registered = saxpy.add(&saxpy_impl);
+// The first call of saxpy(a, x, y, n) selects the implementation for the highest target not
+// above best_dispatch_target() and caches the function pointer.
+//
+// The Caller template parameters keep the copies of the member functions compiled for
+// different targets apart, such that the linker cannot merge them. Don't specify them.
+// vc_compile_for_dispatch does the same for the rest of Vc via Vc_DISPATCH_NAMESPACE. The
+// helper functions and templates of the kernel source itself need internal linkage, too.
+template <class Signature> class dispatched;
+
+template <class R, class... Args> class dispatched<R(Args...)>
+{
+public:
+    using function_type = R(Args...);
+
+    constexpr dispatched() = default;
+    dispatched(const dispatched &) = delete;
+    dispatched &operator=(const dispatched &) = delete;
+
+    // Registers f as the implementation for the target of the caller. Returns true, such
+    // that the call can initialize a static variable.
+    template <dispatch_target Caller = current_dispatch_target>
+    bool add(function_type *f) noexcept
+    {
+        candidates[int(Caller)] = f;
+        resolved.store(nullptr, std::memory_order_release);
+        return true;
+    }
+
+    // Returns the target of the implementation that calls are dispatched to.
+    template <dispatch_target Caller = current_dispatch_target>
+    dispatch_target selected_target() const
+    {
+        return static_cast<dispatch_target>(select<Caller>());
+    }
+
+    // Returns the implementation that calls are dispatched to.
+    template <dispatch_target Caller = current_dispatch_target>
+    function_type *resolve() const
+    {
+        function_type *f = resolved.load(std::memory_order_acquire);
+        if (f == nullptr) {
+            f = candidates[select<Caller>()];
+            resolved.store(f, std::memory_order_release);
+        }
+        return f;
+    }
+
+    template <dispatch_target Caller = current_dispatch_target>
+    R operator()(Args... args) const
+    {
+        return resolve<Caller>()(std::forward<Args>(args)...);
+    }
+
+private:
+    template <dispatch_target Caller> int select() const
+    {
+        for (int t = int(best_dispatch_target<Caller>()); t >= 0; --t) {
+            if (candidates[t] != nullptr) {
+                return t;
+            }
+        }
+        // none of the registered implementations can execute on this CPU
+        std::abort();
+    }
+
+    function_type *candidates[int(dispatch_target::avx512) + 1] = {};
+    mutable std::atomic<function_type *> resolved = {nullptr};
+};
+//}}}1
+Vc_DISPATCH_SHARED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_DISPATCH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,159 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_DIVISOR_H_
+#define VC_DATAPAR_DIVISOR_H_
+
+#include <algorithm>
+#include "synopsis.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// ceil_log2 {{{1
+// Returns the smallest l with 2^l >= d.
+template <class U> constexpr int ceil_log2(U d)
+{
+    int l = 0;
+    while (l < std::numeric_limits<U>::digits && U(U(1) << l) < d) {
+        ++l;
+    }
+    return l;
+}
+
+// udiv_wide {{{1
+// Returns floor(hi * 2^W / d) for W = digits of U. Requires hi < d, which guarantees that
+// the quotient fits into U. This is only used for precomputing divisor constants, thus
+// plain long division by bits is good enough.
+template <class U> constexpr U udiv_wide(U hi, U d)
+{
+    constexpr int W = std::numeric_limits<U>::digits;
+    U r = hi;
+    U q = 0;
+    for (int i = 0; i < W; ++i) {
+        const bool carry = (r >> (W - 1)) != 0;
+        r = U(r << 1);
+        q = U(q << 1);
+        if (carry || r >= d) {
+            r = U(r - d);
+            q = U(q | 1);
+        }
+    }
+    return q;
+}
+//}}}1
+}  // namespace detail
+
+// divisor {{{1
+// Division of datapar objects by a loop-invariant integer. The constructor precomputes a
+// multiplier and shift counts (T. Granlund and P. L. Montgomery, "Division by Invariant
+// Integers using Multiplication", 1994: Figure 4.1 for unsigned and Figure 5.1 for signed
+// division), such that n / d only needs a multiply-high, shifts by a uniform count, and
+// additions. The result is equal to the built-in operator, i.e. the quotient is truncated
+// towards zero.
+//
+//     const Vc::divisor<V> width = bucket_width;
+//     V bucket = x / width;
+template <class V> class divisor
+{
+    static_assert(is_datapar_v<V> && std::is_integral<typename V::value_type>::value,
+                  "divisor<V> requires V to be a datapar type with integral value_type");
+    using T = typename V::value_type;
+    using U = std::make_unsigned_t<T>;
+    using impl = detail::get_impl_t<V>;
+    static constexpr int digits = std::numeric_limits<U>::digits;
+
+public:
+    using datapar_type = V;
+    using value_type = T;
+
+    // d_ must not be zero
+    divisor(T d_) : divisor(d_, std::is_signed<T>()) {}
+
+    T value() const { return d; }
+
+    friend V operator/(const V &n, const divisor &x)
+    {
+        return x.divide(n, std::is_signed<T>());
+    }
+    friend V operator%(const V &n, const divisor &x) { return n - (n / x) * x.dv; }
+    friend V &operator/=(V &n, const divisor &x) { return n = n / x; }
+    friend V &operator%=(V &n, const divisor &x) { return n = n % x; }
+
+private:
+    divisor(T d_, std::false_type)
+        : d(d_), dv(d_), shift1(0), shift2(0), unit(false)
+    {
+        const int l = detail::ceil_log2(d);
+        const U two_l = l == digits ? U(0) : U(U(1) << l);  // 2^l mod 2^W
+        multiplier = V(T(detail::udiv_wide(U(two_l - d), d) + 1));
+        shift1 = std::min(l, 1);
+        shift2 = std::max(l - 1, 0);
+    }
+
+    divisor(T d_, std::true_type)
+        : d(d_), dv(d_), shift1(0), shift2(0), unit(d_ == 1 || d_ == -1)
+    {
+        const U ad = d < 0 ? U(U(0) - U(d)) : U(d);
+        const int l = std::max(detail::ceil_log2(ad), 1);
+        // the multiplier is m - 2^W with 2^(W-1) < m < 2^W, which wraps to m in U
+        multiplier = V(T(unit ? U(0) : U(detail::udiv_wide(U(U(1) << (l - 1)), ad) + 1)));
+        shift2 = l - 1;
+        sign = V(d < 0 ? T(-1) : T(0));
+    }
+
+    V divide(const V &n, std::false_type) const
+    {
+        const V t = impl::mulhi(multiplier, n);
+        return (t + ((n - t) >> shift1)) >> shift2;
+    }
+
+    V divide(const V &n, std::true_type) const
+    {
+        if (unit) {
+            // m = 2^W + 1 is out of range and n + mulhi(m - 2^W, n) would overflow
+            return (n ^ sign) - sign;
+        }
+        // n >> (digits - 1) is -1 for negative n, thus the subtraction rounds towards zero
+        const V q = ((n + impl::mulhi(multiplier, n)) >> shift2) - (n >> (digits - 1));
+        return (q ^ sign) - sign;
+    }
+
+    T d;
+    V dv;
+    V multiplier;
+    V sign;
+    int shift1;
+    int shift2;
+    bool unit;  // |d| == 1, only used for signed T
+};
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_DIVISOR_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,427 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_DATAPAR_EXECUTION_H_
+#define VC_DATAPAR_EXECUTION_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "algorithm.h"
+#include "../Allocator"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace execution
+{
+// parallel_simd_policy {{{1
+// Runs the datapar loops of the range algorithms on all cores: the range is split into
+// vector-aligned chunks of about chunk_bytes, which the threads of a work-stealing pool
+// process. Reductions merge the chunk results in the order of the chunks, thus the result
+// does not depend on the number of threads or the schedule. As with the standard parallel
+// policies, an exception escaping a function object calls std::terminate. (non-std)
+struct parallel_simd_policy {
+    std::size_t chunk_bytes = 32 * 1024;  // about half of a typical L1 data cache
+};
+
+constexpr parallel_simd_policy par_simd = {};
+}  // namespace execution
+
+namespace detail
+{
+// thread_pool {{{1
+// Worker threads for parallel loops over task indices. Every participant, including the
+// calling thread, starts with an equal share of the indices and takes them from the front.
+// A participant that runs out of work steals the back half of the largest remaining share.
+class thread_pool
+{
+public:
+    // The pool has one worker thread per logical processor, except for the calling thread.
+    static thread_pool &instance()
+    {
+        static thread_pool pool(std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    size_t size() const { return shares.size(); }
+
+    // Calls f(i) for every i in [0, n), in unspecified order and on unspecified threads.
+    // Nested calls from inside f, and n beyond the 32-bit task indices of the shares, run
+    // sequentially on the calling thread.
+    template <class F> void parallel_for(size_t n, F &&f)
+    {
+        if (n <= 1 || n > max_tasks || workers.empty() || in_parallel_region()) {
+            for (size_t i = 0; i < n; ++i) {
+                f(i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> job_lock(job_mutex);
+        const size_t participants = size();
+        for (size_t p = 0; p < participants; ++p) {
+            shares[p].range.store(pack(n * p / participants, n * (p + 1) / participants),
+                                  std::memory_order_relaxed);
+        }
+        job_context = std::addressof(f);
+        job_invoke = [](void *context, size_t i) {
+            (*static_cast<std::remove_reference_t<F> *>(context))(i);
+        };
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished_workers = 0;
+            ++generation;
+        }
+        wake.notify_all();
+        participate(0);
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&] { return finished_workers == workers.size(); });
+    }
+
+private:
+    // Every share is on a cache line of its own. std::allocator ignores the alignment of
+    // over-aligned types before C++17, thus the shares use Vc::Allocator.
+    struct alignas(64) share {
+        std::atomic<std::uint64_t> range = {0};  // [begin, end) in the low and high halves
+    };
+    static constexpr size_t max_tasks = 0xffffffffu;
+
+    explicit thread_pool(unsigned threads) : shares(threads)
+    {
+        for (unsigned i = 1; i < threads; ++i) {
+            workers.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (auto &t : workers) {
+            t.join();
+        }
+    }
+
+    static std::uint64_t pack(std::uint64_t begin, std::uint64_t end)
+    {
+        return begin | (end << 32);
+    }
+    static size_t begin_of(std::uint64_t r) { return r & 0xffffffffu; }
+    static size_t end_of(std::uint64_t r) { return r >> 32; }
+
+    static bool &in_parallel_region()
+    {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    void work(size_t index)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        std::uint64_t seen = 0;
+        for (;;) {
+            wake.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+            lock.unlock();
+            participate(index);
+            lock.lock();
+            if (++finished_workers == workers.size()) {
+                done.notify_one();
+            }
+        }
+    }
+
+    // Executes tasks until no share has any left.
+    void participate(size_t index) noexcept
+    {
+        in_parallel_region() = true;
+        size_t i;
+        while (take_front(shares[index], i) || steal(index, i)) {
+            job_invoke(job_context, i);
+        }
+        in_parallel_region() = false;
+    }
+
+    static bool take_front(share &s, size_t &i)
+    {
+        std::uint64_t r = s.range.load(std::memory_order_acquire);
+        while (begin_of(r) < end_of(r)) {
+            if (s.range.compare_exchange_weak(r, pack(begin_of(r) + 1, end_of(r)),
+                                              std::memory_order_acq_rel)) {
+                i = begin_of(r);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Moves the back half of the largest share to the share of the thief and takes its
+    // first task.
+    bool steal(size_t thief, size_t &i)
+    {
+        for (;;) {
+            size_t victim = thief;
+            size_t largest = 0;
+            for (size_t p = 0; p < shares.size(); ++p) {
+                const std::uint64_t r = shares[p].range.load(std::memory_order_relaxed);
+                if (end_of(r) > begin_of(r) && end_of(r) - begin_of(r) > largest) {
+                    largest = end_of(r) - begin_of(r);
+                    victim = p;
+                }
+            }
+            if (largest == 0) {
+                return false;
+            }
+            std::uint64_t r = shares[victim].range.load(std::memory_order_acquire);
+            const size_t b = begin_of(r), e = end_of(r);
+            if (b >= e) {
+                continue;
+            }
+            const size_t mid = e - (e - b + 1) / 2;
+            if (shares[victim].range.compare_exchange_strong(r, pack(b, mid),
+                                                             std::memory_order_acq_rel)) {
+                shares[thief].range.store(pack(mid + 1, e), std::memory_order_release);
+                i = mid;
+                return true;
+            }
+        }
+    }
+
+    std::vector<share, Allocator<share>> shares;
+    std::vector<std::thread> workers;
+    std::mutex job_mutex;  // one parallel_for at a time
+    std::mutex mutex;      // protects generation, finished_workers, and stop
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::uint64_t generation = 0;
+    size_t finished_workers = 0;
+    bool stop = false;
+    void *job_context = nullptr;
+    void (*job_invoke)(void *, size_t) = nullptr;
+};
+
+// range_chunks {{{1
+// Splits [0, n) into chunks of the parallel_simd_policy. All chunks but the first start at a
+// vector-aligned entry of the range starting at `aligned`, and all but the last hold a
+// multiple of N entries.
+struct range_chunks {
+    template <class T>
+    range_chunks(const T *aligned, size_t n_, size_t N, const execution::parallel_simd_policy &p)
+        : n(n_), step(std::max(N, p.chunk_bytes / sizeof(T) / N * N))
+    {
+        const auto addr = reinterpret_cast<std::uintptr_t>(aligned);
+        head = addr % sizeof(T) == 0 ? (N - addr / sizeof(T) % N) % N : 0;
+        count = n > head ? (n - head + step - 1) / step : 1;
+    }
+    size_t begin(size_t c) const { return c == 0 ? 0 : std::min(n, head + c * step); }
+    size_t end(size_t c) const { return begin(c + 1); }
+
+    size_t n, step, head, count;
+};
+//}}}1
+}  // namespace detail
+
+// for_each {{{1
+// Runs for_each(first, last, f) on chunks of the range in parallel. (non-std)
+template <class ContiguousIterator, class UnaryFunction>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          void>
+for_each(const execution::parallel_simd_policy &policy, ContiguousIterator first,
+         ContiguousIterator last, UnaryFunction f)
+{
+    using T = typename std::iterator_traits<ContiguousIterator>::value_type;
+    const auto n = last - first;
+    if (n <= 0) {
+        return;
+    }
+    auto *const mem = std::addressof(*first);
+    const detail::range_chunks chunks(mem, size_t(n), native_datapar<T>::size(), policy);
+    detail::thread_pool::instance().parallel_for(chunks.count, [&](size_t c) {
+        Vc::for_each(mem + chunks.begin(c), mem + chunks.end(c), [&f](auto &x) { f(x); });
+    });
+}
+
+// transform {{{1
+// Runs transform(first, last, out, op) on chunks of the range in parallel. (non-std)
+template <class ContiguousIterator, class ContiguousOutputIterator, class UnaryOperation>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          ContiguousOutputIterator>
+transform(const execution::parallel_simd_policy &policy, ContiguousIterator first,
+          ContiguousIterator last, ContiguousOutputIterator out, UnaryOperation op)
+{
+    using T = typename std::iterator_traits<ContiguousIterator>::value_type;
+    const auto n = last - first;
+    if (n > 0) {
+        const T *const in = std::addressof(*first);
+        auto *const o = std::addressof(*out);
+        const detail::range_chunks chunks(o, size_t(n), native_datapar<T>::size(), policy);
+        detail::thread_pool::instance().parallel_for(chunks.count, [&](size_t c) {
+            const size_t b = chunks.begin(c);
+            Vc::transform(in + b, in + chunks.end(c), o + b, op);
+        });
+    }
+    return out + n;
+}
+
+// Runs transform(first1, last1, first2, out, op) on chunks of the ranges in parallel.
+// (non-std)
+template <class ContiguousIterator1, class ContiguousIterator2, class ContiguousOutputIterator,
+          class BinaryOperation>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator1>::value_type>::value,
+          ContiguousOutputIterator>
+transform(const execution::parallel_simd_policy &policy, ContiguousIterator1 first1,
+          ContiguousIterator1 last1, ContiguousIterator2 first2,
+          ContiguousOutputIterator out, BinaryOperation op)
+{
+    using T1 = typename std::iterator_traits<ContiguousIterator1>::value_type;
+    using T2 = typename std::iterator_traits<ContiguousIterator2>::value_type;
+    const auto n = last1 - first1;
+    if (n > 0) {
+        const T1 *const in1 = std::addressof(*first1);
+        const T2 *const in2 = std::addressof(*first2);
+        auto *const o = std::addressof(*out);
+        const detail::range_chunks chunks(o, size_t(n), native_datapar<T1>::size(), policy);
+        detail::thread_pool::instance().parallel_for(chunks.count, [&](size_t c) {
+            const size_t b = chunks.begin(c);
+            Vc::transform(in1 + b, in1 + chunks.end(c), in2 + b, o + b, op);
+        });
+    }
+    return out + n;
+}
+
+// transform_reduce {{{1
+namespace detail
+{
+// Reduces every chunk on its own and merges the chunk results in order, starting from init.
+template <class T, class R, class Reduce, class ChunkReduce>
+R parallel_reduce_chunks(const T *aligned, size_t n,
+                         const execution::parallel_simd_policy &policy, R init,
+                         Reduce &reduce, ChunkReduce &&chunk_reduce)
+{
+    const range_chunks chunks(aligned, n, native_datapar<T>::size(), policy);
+    std::unique_ptr<R[]> partial(new R[chunks.count]);
+    thread_pool::instance().parallel_for(chunks.count, [&](size_t c) {
+        partial[c] = chunk_reduce(chunks.begin(c), chunks.end(c));
+    });
+    for (size_t c = 0; c < chunks.count; ++c) {
+        init = static_cast<R>(reduce(init, partial[c]));
+    }
+    return init;
+}
+}  // namespace detail
+
+// Computes transform_reduce(first, last, init, reduce, transform) in parallel. (non-std)
+template <class ContiguousIterator, class T, class BinaryReductionOp, class UnaryTransformOp>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          T>
+transform_reduce(const execution::parallel_simd_policy &policy, ContiguousIterator first,
+                 ContiguousIterator last, T init, BinaryReductionOp reduce,
+                 UnaryTransformOp transform)
+{
+    using U = typename std::iterator_traits<ContiguousIterator>::value_type;
+    const auto n = last - first;
+    if (n <= 0) {
+        return init;
+    }
+    const U *const in = std::addressof(*first);
+    return detail::parallel_reduce_chunks(
+        in, size_t(n), policy, init, reduce, [&](size_t b, size_t e) {
+            return detail::transform_reduce_chunks<U, native_datapar<U>::size()>(
+                in + b, e - b, T(), false, reduce, [&](auto k, size_t i, auto flags) {
+                    return transform(
+                        detail::datapar_n<U, decltype(k)::value>(in + b + i, flags));
+                });
+        });
+}
+
+// Computes transform_reduce(first1, last1, first2, init, reduce, transform) in parallel.
+// (non-std)
+template <class ContiguousIterator1, class ContiguousIterator2, class T,
+          class BinaryReductionOp, class BinaryTransformOp>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator1>::value_type>::value,
+          T>
+transform_reduce(const execution::parallel_simd_policy &policy, ContiguousIterator1 first1,
+                 ContiguousIterator1 last1, ContiguousIterator2 first2, T init,
+                 BinaryReductionOp reduce, BinaryTransformOp transform)
+{
+    using U1 = typename std::iterator_traits<ContiguousIterator1>::value_type;
+    using U2 = typename std::iterator_traits<ContiguousIterator2>::value_type;
+    const auto n = last1 - first1;
+    if (n <= 0) {
+        return init;
+    }
+    const U1 *const in1 = std::addressof(*first1);
+    const U2 *const in2 = std::addressof(*first2);
+    return detail::parallel_reduce_chunks(
+        in1, size_t(n), policy, init, reduce, [&](size_t b, size_t e) {
+            return detail::transform_reduce_chunks<U1, native_datapar<U1>::size()>(
+                in1 + b, e - b, T(), false, reduce, [&](auto k, size_t i, auto flags) {
+                    constexpr size_t K = decltype(k)::value;
+                    return transform(
+                        detail::datapar_n<U1, K>(in1 + b + i, flags),
+                        detail::datapar_n<U2, K>(in2 + b + i, flags::element_aligned));
+                });
+        });
+}
+
+template <class ContiguousIterator1, class ContiguousIterator2, class T>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator1>::value_type>::value,
+          T>
+transform_reduce(const execution::parallel_simd_policy &policy, ContiguousIterator1 first1,
+                 ContiguousIterator1 last1, ContiguousIterator2 first2, T init)
+{
+    return Vc::transform_reduce(policy, first1, last1, first2, init, std::plus<>(),
+                                std::multiplies<>());
+}
+
+// reduce {{{1
+// Computes reduce(first, last, init, binary_op) in parallel. (non-std)
+template <class ContiguousIterator, class T, class BinaryOperation = std::plus<>>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          T>
+reduce(const execution::parallel_simd_policy &policy, ContiguousIterator first,
+       ContiguousIterator last, T init, BinaryOperation binary_op = BinaryOperation())
+{
+    return Vc::transform_reduce(policy, first, last, init, binary_op,
+                                [](const auto &x) { return x; });
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_EXECUTION_H_
+
+// vim: foldmethod=marker
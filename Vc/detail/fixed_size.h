@@ -32,6 +32,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "detail.h"
 #include <array>
 #include <cmath>
+#include <cstring>
+#ifdef Vc_HAVE_SSE2
+#include "x86/intrinsics.h"
+#endif
 
 Vc_VERSIONED_NAMESPACE_BEGIN
 namespace detail {
@@ -88,6 +92,38 @@ template <int N> struct fixed_size_datapar_impl {
         masked_load_impl(merge.d, k.d, mem, index_seq);
     }
 
+    // gather {{{2
+    template <class T, class U, class IV, size_t... I>
+    static Vc_INTRINSIC datapar_member_type<T> gather_impl(
+        const U *mem, const IV &idx, std::index_sequence<I...>) noexcept
+    {
+        return {static_cast<T>(mem[idx[I]])...};
+    }
+    template <class T, class U, class I, class IA>
+    static inline datapar_member_type<T> gather(const U *mem,
+                                                const Vc::datapar<I, IA> &idx,
+                                                type_tag<T>) noexcept
+    {
+        return gather_impl<T>(mem, idx, index_seq);
+    }
+
+    // masked gather {{{2
+    template <class T, class U, class IV, size_t... I>
+    static Vc_INTRINSIC void masked_gather_impl(datapar_member_type<T> &merge,
+                                                const mask_member_type &mask,
+                                                const U *mem, const IV &idx,
+                                                std::index_sequence<I...>) noexcept
+    {
+        auto &&x = {(merge[I] = mask[I] ? static_cast<T>(mem[idx[I]]) : merge[I])...};
+        unused(x);
+    }
+    template <class T, class A, class U, class I, class IA>
+    static inline void masked_gather(datapar<T> &merge, const Vc::mask<T, A> &k,
+                                     const U *mem, const Vc::datapar<I, IA> &idx) noexcept
+    {
+        masked_gather_impl(merge.d, k.d, mem, idx, index_seq);
+    }
+
     // store {{{2
     template <class T, class U, size_t... I>
     static Vc_INTRINSIC void store_impl(const datapar_member_type<T> &v, U *mem,
@@ -119,6 +155,40 @@ template <int N> struct fixed_size_datapar_impl {
         return masked_store_impl(v.d, mem, index_seq, k.d);
     }
 
+    // scatter {{{2
+    template <class T, class U, class IV, size_t... I>
+    static Vc_INTRINSIC void scatter_impl(const datapar_member_type<T> &v, U *mem,
+                                          const IV &idx,
+                                          std::index_sequence<I...>) noexcept
+    {
+        auto &&x = {(mem[idx[I]] = static_cast<U>(v[I]))...};
+        unused(x);
+    }
+    template <class T, class U, class I, class IA>
+    static inline void scatter(const datapar_member_type<T> &v, U *mem,
+                               const Vc::datapar<I, IA> &idx, type_tag<T>) noexcept
+    {
+        scatter_impl(v, mem, idx, index_seq);
+    }
+
+    // masked scatter {{{2
+    template <class T, class U, class IV, size_t... I>
+    static Vc_INTRINSIC void masked_scatter_impl(const datapar_member_type<T> &v, U *mem,
+                                                 const IV &idx,
+                                                 std::index_sequence<I...>,
+                                                 const mask_member_type &k) noexcept
+    {
+        auto &&x = {(k[I] ? mem[idx[I]] = static_cast<U>(v[I]) : false)...};
+        unused(x);
+    }
+    template <class T, class A, class U, class I, class IA>
+    static inline void masked_scatter(const datapar<T> &v, U *mem,
+                                      const Vc::datapar<I, IA> &idx,
+                                      const Vc::mask<T, A> &k) noexcept
+    {
+        masked_scatter_impl(v.d, mem, idx, index_seq, k.d);
+    }
+
     // negation {{{2
     template <class T, size_t... I>
     static Vc_INTRINSIC mask_member_type negate_impl(const datapar_member_type<T> &x,
@@ -291,6 +361,36 @@ template <int N> struct fixed_size_datapar_impl {
                 })};
     }
 
+    template <class T, class A>
+    static inline Vc::datapar<T, A> bit_shift_left(const Vc::datapar<T, A> &x, int y)
+    {
+        return {private_init,
+                generate_from_n_evaluations<N, datapar_member_type<T>>([&](auto i) {
+                    return static_cast<T>(Vc::detail::promote_preserving_unsigned(x.d[i])
+                                          << y);
+                })};
+    }
+
+    template <class T, class A>
+    static inline Vc::datapar<T, A> bit_shift_right(const Vc::datapar<T, A> &x, int y)
+    {
+        return {private_init,
+                generate_from_n_evaluations<N, datapar_member_type<T>>([&](auto i) {
+                    return static_cast<T>(
+                        Vc::detail::promote_preserving_unsigned(x.d[i]) >> y);
+                })};
+    }
+
+    // mulhi {{{2
+    template <class T, class A>
+    static inline Vc::datapar<T, A> mulhi(const Vc::datapar<T, A> &x,
+                                          const Vc::datapar<T, A> &y)
+    {
+        return {private_init,
+                generate_from_n_evaluations<N, datapar_member_type<T>>(
+                    [&](auto i) { return Vc::detail::mulhi(x.d[i], y.d[i]); })};
+    }
+
     // sqrt {{{2
     template <class T, class A>
     static inline Vc::datapar<T, A> sqrt(const Vc::datapar<T, A> &x) noexcept {
@@ -299,6 +399,61 @@ template <int N> struct fixed_size_datapar_impl {
                                   [&](auto i) { return static_cast<T>(sqrt(x.d[i])); })};
     }
 
+    // fma {{{2
+    template <class T, class A>
+    static inline Vc::datapar<T, A> fma(const Vc::datapar<T, A> &a,
+                                        const Vc::datapar<T, A> &b,
+                                        const Vc::datapar<T, A> &c) noexcept
+    {
+        return {private_init,
+                generate_from_n_evaluations<N, datapar_member_type<T>>([&](auto i) {
+                    return static_cast<T>(std::fma(a.d[i], b.d[i], c.d[i]));
+                })};
+    }
+
+    // add_sat, sub_sat & avg {{{2
+#define Vc_SATURATING_OP_(name_)                                                         \
+    template <class T, class A>                                                          \
+    static inline Vc::datapar<T, A> name_(const Vc::datapar<T, A> &x,                    \
+                                          const Vc::datapar<T, A> &y) noexcept           \
+    {                                                                                    \
+        return {private_init,                                                            \
+                generate_from_n_evaluations<N, datapar_member_type<T>>(                  \
+                    [&](auto i) { return detail::name_(x.d[i], y.d[i]); })};             \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
+    Vc_SATURATING_OP_(add_sat);
+    Vc_SATURATING_OP_(sub_sat);
+    Vc_SATURATING_OP_(avg);
+#undef Vc_SATURATING_OP_
+
+    // exponent {{{2
+    template <class T, class A>
+    static inline Vc::datapar<T, A> exponent(const Vc::datapar<T, A> &x) noexcept {
+        return {private_init, generate_from_n_evaluations<N, datapar_member_type<T>>(
+                                  [&](auto i) { return static_cast<T>(std::ilogb(x.d[i])); })};
+    }
+
+    // fraction {{{2
+    template <class T, class A>
+    static inline Vc::datapar<T, A> fraction(const Vc::datapar<T, A> &x) noexcept {
+        return {private_init,
+                generate_from_n_evaluations<N, datapar_member_type<T>>([&](auto i) {
+                    int e;
+                    return static_cast<T>(std::frexp(x.d[i], &e));
+                })};
+    }
+
+    // exp2_integral {{{2
+    template <class T, class A>
+    static inline Vc::datapar<T, A> exp2_integral(const Vc::datapar<T, A> &n) noexcept {
+        return {private_init,
+                generate_from_n_evaluations<N, datapar_member_type<T>>([&](auto i) {
+                    return static_cast<T>(std::ldexp(T(1), static_cast<int>(n.d[i])));
+                })};
+    }
+
     // abs {{{2
     template <class T, class A>
     static inline Vc::datapar<T, A> abs(const Vc::datapar<T, A> &x) noexcept {
@@ -339,6 +494,7 @@ template <int N> struct fixed_size_datapar_impl {
     Vc_CMP_OPERATIONS(greater);
     Vc_CMP_OPERATIONS(less_equal);
     Vc_CMP_OPERATIONS(greater_equal);
+#undef Vc_CMP_OPERATIONS
 
     // smart_reference access {{{2
     template <class T, class A>
@@ -351,6 +507,56 @@ template <int N> struct fixed_size_datapar_impl {
     {
         v.d[i] = std::forward<U>(x);
     }
+
+    // masked assignment {{{2
+    template <class T, class U>
+    static Vc_INTRINSIC void masked_assign(const mask<T> &k, datapar<T> &lhs, const U &rhs)
+    {
+        execute_n_times<N>([&](auto i) {
+            if (k.d[i]) {
+                lhs.d[i] = get_entry(rhs, i);
+            }
+        });
+    }
+
+    template <class T>
+    static Vc_INTRINSIC void masked_assign(const mask<T> &k, mask<T> &lhs,
+                                           const mask<T> &rhs)
+    {
+        execute_n_times<N>([&](auto i) {
+            if (k.d[i]) {
+                lhs.d[i] = rhs.d[i];
+            }
+        });
+    }
+
+    template <template <typename> class Op, class T, class U>
+    static Vc_INTRINSIC void masked_cassign(const mask<T> &k, datapar<T> &lhs, const U &rhs)
+    {
+        execute_n_times<N>([&](auto i) {
+            if (k.d[i]) {
+                lhs.d[i] = Op<T>{}(lhs.d[i], get_entry(rhs, i));
+            }
+        });
+    }
+
+    template <template <typename> class Op, class T>
+    static Vc_INTRINSIC datapar<T> masked_unary(const mask<T> &k, const datapar<T> &v)
+    {
+        return {private_init, generate_from_n_evaluations<N, datapar_member_type<T>>(
+                                  [&](auto i) { return k.d[i] ? Op<T>{}(v.d[i]) : v.d[i]; })};
+    }
+
+private:
+    // the right-hand side of masked assignments is either a datapar or a scalar
+    template <class T> static Vc_INTRINSIC T get_entry(const datapar<T> &x, size_t i)
+    {
+        return x.d[i];
+    }
+    template <class U> static Vc_INTRINSIC const U &get_entry(const U &x, size_t)
+    {
+        return x;
+    }
     // }}}2
 };
 
@@ -489,12 +695,650 @@ template <int N> struct fixed_size_mask_impl {
     // }}}2
 };
 
+// chunk ABI {{{1
+// fixed_size<N> objects of a vectorizable T are stored as N / W datapar (or mask) objects
+// of the widest ABI with 1 < W <= N entries, followed by a fixed_size<N % W> object for
+// the remaining entries. All ABIs the target supports are considered, not only native and
+// compatible: with AVX-512, fixed_size<float, 12> is one AVX chunk plus a fixed_size<4>
+// (thus SSE) rest. If no such ABI exists (e.g. for long double or small N), the entries are
+// stored in a std::array instead.
+
+// The ABI that abi_for_size maps W entries of T to, or void if that is no SIMD ABI. Plain
+// char has no mapping of its own and uses the one of schar or uchar.
+template <class T>
+using chunk_lookup_type =
+    std::conditional_t<std::is_same<T, char>::value,
+                       std::conditional_t<std::is_signed<char>::value, schar, uchar>, T>;
+template <class T, size_t W,
+          bool = (W > 1 && W <= size_t(datapar_abi::max_fixed_size))
+#ifdef Vc_HAVE_FULL_AVX512_ABI
+                 || W == 64
+#endif
+          >
+struct simd_abi_for_size {
+    using type = void;
+};
+template <class T, size_t W> struct simd_abi_for_size<T, W, true> {
+    using A = abi_for_size_t<chunk_lookup_type<T>, W>;
+    using type = std::conditional_t<std::is_same<A, datapar_abi::fixed_size<W>>::value, void, A>;
+};
+
+// Halves the vector size, starting from 64 Bytes, until an ABI with at most N entries
+// exists.
+template <class T, int N, size_t Bytes = 64,
+          class A = typename simd_abi_for_size<T, Bytes / sizeof(T)>::type,
+          bool = !std::is_void<A>::value && Bytes / sizeof(T) <= size_t(N)>
+struct fixed_size_chunk_abi_search {
+    using type = typename fixed_size_chunk_abi_search<T, N, Bytes / 2>::type;
+};
+template <class T, int N, size_t Bytes, class A>
+struct fixed_size_chunk_abi_search<T, N, Bytes, A, true> {
+    using type = A;
+};
+template <class T, int N, class A> struct fixed_size_chunk_abi_search<T, N, 16, A, false> {
+    using type = void;
+};
+
+template <class T, int N,
+          bool = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+struct fixed_size_chunk_abi {
+    using type = void;
+};
+template <class T, int N> struct fixed_size_chunk_abi<T, N, true> {
+    using type = typename fixed_size_chunk_abi_search<T, N>::type;
+};
+template <class T, int N>
+using fixed_size_chunk_abi_t = typename fixed_size_chunk_abi<T, N>::type;
+
+// fixed_size_chunks {{{1
+// The member type of chunked datapar (V = datapar<T, A>) and mask (V = mask<T, A>)
+// objects. Rest is the fixed_size datapar or mask type of the remaining entries, or void.
+template <class V, int C, class Rest> struct fixed_size_chunks {
+    using value_type = typename V::value_type;
+    static constexpr int chunk_size = V::size();
+    static constexpr int chunk_count = C;
+    static constexpr int rest_offset = C * chunk_size;
+    static constexpr bool has_rest = true;
+
+    std::array<V, C> chunks;
+    Rest rest;
+
+    fixed_size_chunks() = default;
+    template <class... Us, class = enable_if<sizeof...(Us) == size_t(rest_offset) + Rest::size()>>
+    Vc_INTRINSIC fixed_size_chunks(Us... xs);
+
+    // get and set must be inlined: GCC's identical code folding merges the out-of-line
+    // (partially inlined) copies for different N, but ignores the value ranges they were
+    // optimized with (GCC PR ipa/113907). fixed_size<float, 9> then read entries 4..7
+    // from the first chunk.
+    Vc_INTRINSIC value_type get(int i) const
+    {
+        return i < rest_offset ? value_type(chunks[i / chunk_size][i % chunk_size])
+                               : value_type(rest[i - rest_offset]);
+    }
+    template <class U> Vc_INTRINSIC void set(int i, U &&x)
+    {
+        if (i < rest_offset) {
+            chunks[i / chunk_size][i % chunk_size] = std::forward<U>(x);
+        } else {
+            rest[i - rest_offset] = std::forward<U>(x);
+        }
+    }
+};
+
+template <class V, int C> struct fixed_size_chunks<V, C, void> {
+    using value_type = typename V::value_type;
+    static constexpr int chunk_size = V::size();
+    static constexpr int chunk_count = C;
+    static constexpr int rest_offset = C * chunk_size;
+    static constexpr bool has_rest = false;
+
+    std::array<V, C> chunks;
+
+    fixed_size_chunks() = default;
+    template <class... Us, class = enable_if<sizeof...(Us) == size_t(rest_offset)>>
+    Vc_INTRINSIC fixed_size_chunks(Us... xs);
+
+    Vc_INTRINSIC value_type get(int i) const
+    {
+        return chunks[i / chunk_size][i % chunk_size];
+    }
+    template <class U> Vc_INTRINSIC void set(int i, U &&x)
+    {
+        chunks[i / chunk_size][i % chunk_size] = std::forward<U>(x);
+    }
+};
+
+template <class T, int N, class A = fixed_size_chunk_abi_t<T, N>,
+          int W = int(datapar_size_v<T, A>)>
+struct fixed_size_chunked_storage {
+    using datapar_type = fixed_size_chunks<
+        Vc::datapar<T, A>, N / W,
+        std::conditional_t<N % W == 0, void,
+                           Vc::datapar<T, datapar_abi::fixed_size<(N % W == 0 ? 1 : N % W)>>>>;
+    using mask_type = fixed_size_chunks<
+        Vc::mask<T, A>, N / W,
+        std::conditional_t<N % W == 0, void,
+                           Vc::mask<T, datapar_abi::fixed_size<(N % W == 0 ? 1 : N % W)>>>>;
+};
+
+// for_each_chunk {{{1
+// Calls f(offset, s.chunks[i], ss.chunks[i]...) for every chunk i, and then f(offset,
+// s.rest, ss.rest...), where offset is the index of the first entry of the chunk.
+template <class F, class S, class... Ss>
+Vc_INTRINSIC void for_each_chunk_rest(std::true_type, F &&f, S &&s, Ss &&... ss)
+{
+    f(size_t(std::decay_t<S>::rest_offset), s.rest, ss.rest...);
+}
+template <class F, class... Ss>
+Vc_INTRINSIC void for_each_chunk_rest(std::false_type, F &&, Ss &&...)
+{
+}
+
+template <class F, class S, class... Ss>
+Vc_INTRINSIC void for_each_chunk(F &&f, S &&s, Ss &&... ss)
+{
+    using Storage = std::decay_t<S>;
+    execute_n_times<Storage::chunk_count>([&](auto i) {
+        f(size_t(i * Storage::chunk_size), s.chunks[i], ss.chunks[i]...);
+    });
+    for_each_chunk_rest(bool_constant<Storage::has_rest>(), f, s, ss...);
+}
+
+// Returns the R obtained from applying f to the corresponding chunks of xs.
+template <class R, class F, class... Xs>
+Vc_INTRINSIC R generate_from_chunks(F &&f, const Xs &... xs)
+{
+    R r;
+    for_each_chunk([&](size_t, auto &rc, const auto &... xc) { rc = f(xc...); }, r, xs...);
+    return r;
+}
+
+// Chunks at a multiple of their size are vector aligned if the whole object is. Overaligned
+// accesses only guarantee element alignment for the chunks.
+template <class F> constexpr F chunk_flags(F f) { return f; }
+template <align_val_t A>
+constexpr flags::element_aligned_tag chunk_flags(flags::overaligned_tag<A>)
+{
+    return {};
+}
+
+// The fixed_size implementations of masked compound assignment reach the chunk ABI's
+// implementation via ADL.
+template <template <typename> class Op, class M, class V, class U>
+Vc_INTRINSIC void chunk_masked_cassign(const M &k, V &lhs, const U &rhs)
+{
+    masked_cassign<Op>(k, lhs, rhs);
+}
+template <template <typename> class Op, class M, class V>
+Vc_INTRINSIC V chunk_masked_unary(const M &k, const V &v)
+{
+    return masked_unary<Op>(k, v);
+}
+
+template <class V, int C, class Rest>
+template <class... Us, class>
+Vc_INTRINSIC fixed_size_chunks<V, C, Rest>::fixed_size_chunks(Us... xs)
+{
+    const value_type mem[] = {static_cast<value_type>(xs)...};
+    for_each_chunk(
+        [&](size_t offset, auto &c) {
+            c = std::decay_t<decltype(c)>(mem + offset, flags::element_aligned);
+        },
+        *this);
+}
+template <class V, int C>
+template <class... Us, class>
+Vc_INTRINSIC fixed_size_chunks<V, C, void>::fixed_size_chunks(Us... xs)
+{
+    const value_type mem[] = {static_cast<value_type>(xs)...};
+    for_each_chunk(
+        [&](size_t offset, auto &c) {
+            c = std::decay_t<decltype(c)>(mem + offset, flags::element_aligned);
+        },
+        *this);
+}
+
+// chunked datapar impl {{{1
+template <class T, int N> struct fixed_size_chunked_datapar_impl {
+    // member types {{{2
+    using storage = fixed_size_chunked_storage<T, N>;
+    using datapar_member_type = typename storage::datapar_type;
+    using mask_member_type = typename storage::mask_type;
+    using datapar = Vc::datapar<T, datapar_abi::fixed_size<N>>;
+    using mask = Vc::mask<T, datapar_abi::fixed_size<N>>;
+    using size_tag = std::integral_constant<size_t, N>;
+    using type_tag = T *;
+
+    // the index chunk for a gather or scatter of the chunk type C
+    template <class C, class I> using index_chunk = Vc::datapar<I, abi_for_size_t<I, C::size()>>;
+
+    // broadcast {{{2
+    static inline datapar_member_type broadcast(T x, size_tag) noexcept
+    {
+        datapar_member_type r;
+        for_each_chunk([&](size_t, auto &c) { c = x; }, r);
+        return r;
+    }
+
+    // load {{{2
+    template <class U, class F>
+    static inline datapar_member_type load(const U *mem, F f, type_tag) noexcept
+    {
+        datapar_member_type r;
+        for_each_chunk(
+            [&](size_t offset, auto &c) { c.memload(mem + offset, chunk_flags(f)); }, r);
+        return r;
+    }
+
+    // masked load {{{2
+    template <class U, class F>
+    static inline void masked_load(datapar &merge, const mask &k, const U *mem, F f) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, auto &c, const auto &kc) {
+                where(kc, c).memload(mem + offset, chunk_flags(f));
+            },
+            merge.d, k.d);
+    }
+
+    // gather {{{2
+    template <class U, class I, class IA>
+    static inline datapar_member_type gather(const U *mem, const Vc::datapar<I, IA> &idx,
+                                             type_tag) noexcept
+    {
+        datapar_member_type r;
+        for_each_chunk(
+            [&](size_t offset, auto &c) {
+                using C = std::decay_t<decltype(c)>;
+                c = C(mem, index_chunk<C, I>([&](auto i) { return idx[offset + i]; }));
+            },
+            r);
+        return r;
+    }
+
+    // masked gather {{{2
+    template <class U, class I, class IA>
+    static inline void masked_gather(datapar &merge, const mask &k, const U *mem,
+                                     const Vc::datapar<I, IA> &idx) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, auto &c, const auto &kc) {
+                using C = std::decay_t<decltype(c)>;
+                where(kc, c).gather(
+                    mem, index_chunk<C, I>([&](auto i) { return idx[offset + i]; }));
+            },
+            merge.d, k.d);
+    }
+
+    // store {{{2
+    template <class U, class F>
+    static inline void store(const datapar_member_type &v, U *mem, F f, type_tag) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, const auto &c) { c.memstore(mem + offset, chunk_flags(f)); },
+            v);
+    }
+
+    // masked store {{{2
+    template <class U, class F>
+    static inline void masked_store(const datapar &v, U *mem, F f, const mask &k) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, const auto &c, const auto &kc) {
+                where(kc, c).memstore(mem + offset, chunk_flags(f));
+            },
+            v.d, k.d);
+    }
+
+    // scatter {{{2
+    template <class U, class I, class IA>
+    static inline void scatter(const datapar_member_type &v, U *mem,
+                               const Vc::datapar<I, IA> &idx, type_tag) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, const auto &c) {
+                using C = std::decay_t<decltype(c)>;
+                c.scatter(mem, index_chunk<C, I>([&](auto i) { return idx[offset + i]; }));
+            },
+            v);
+    }
+
+    // masked scatter {{{2
+    template <class U, class I, class IA>
+    static inline void masked_scatter(const datapar &v, U *mem,
+                                      const Vc::datapar<I, IA> &idx, const mask &k) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, const auto &c, const auto &kc) {
+                using C = std::decay_t<decltype(c)>;
+                where(kc, c).scatter(
+                    mem, index_chunk<C, I>([&](auto i) { return idx[offset + i]; }));
+            },
+            v.d, k.d);
+    }
+
+    // negation {{{2
+    static inline mask negate(const datapar &x) noexcept
+    {
+        return {private_init, generate_from_chunks<mask_member_type>(
+                                  [](const auto &a) { return !a; }, x.d)};
+    }
+
+    // reductions {{{2
+    // The full chunks are combined vertically, so that only one horizontal reduction of a
+    // native datapar remains (plus the one of the rest).
+    template <class BinaryOperation>
+    static inline T reduce(size_tag, const datapar &x, BinaryOperation &binary_op)
+    {
+        auto acc = x.d.chunks[0];
+        execute_n_times<datapar_member_type::chunk_count - 1>(
+            [&](auto i) { acc = binary_op(acc, x.d.chunks[i + 1]); });
+        return reduce_rest(Vc::reduce(acc, binary_op), x.d, binary_op);
+    }
+
+    // min, max {{{2
+    static inline datapar min(const datapar &a, const datapar &b)
+    {
+        return {private_init,
+                generate_from_chunks<datapar_member_type>(
+                    [](const auto &x, const auto &y) { return Vc::min(x, y); }, a.d, b.d)};
+    }
+
+    static inline datapar max(const datapar &a, const datapar &b)
+    {
+        return {private_init,
+                generate_from_chunks<datapar_member_type>(
+                    [](const auto &x, const auto &y) { return Vc::max(x, y); }, a.d, b.d)};
+    }
+
+    // unary operators {{{2
+#define Vc_UNARY_OPERATION_(name_, expr_)                                                \
+    static inline datapar name_(const datapar &x) noexcept                               \
+    {                                                                                    \
+        return {private_init, generate_from_chunks<datapar_member_type>(                 \
+                                  [](const auto &a) { return expr_; }, x.d)};            \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+    Vc_UNARY_OPERATION_(complement, ~a);
+    Vc_UNARY_OPERATION_(unary_minus, -a);
+    Vc_UNARY_OPERATION_(sqrt, Vc::sqrt(a));
+    Vc_UNARY_OPERATION_(abs, Vc::abs(a));
+    Vc_UNARY_OPERATION_(exponent, get_impl_t<std::decay_t<decltype(a)>>::exponent(a));
+    Vc_UNARY_OPERATION_(fraction, get_impl_t<std::decay_t<decltype(a)>>::fraction(a));
+    Vc_UNARY_OPERATION_(exp2_integral,
+                        get_impl_t<std::decay_t<decltype(a)>>::exp2_integral(a));
+#undef Vc_UNARY_OPERATION_
+
+    // arithmetic operators {{{2
+#define Vc_BINARY_OPERATION_(name_, op_)                                                 \
+    static inline datapar name_(const datapar &x, const datapar &y)                      \
+    {                                                                                    \
+        return {private_init,                                                            \
+                generate_from_chunks<datapar_member_type>(                               \
+                    [](const auto &a, const auto &b) { return a op_ b; }, x.d, y.d)};    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+    Vc_BINARY_OPERATION_(plus, +);
+    Vc_BINARY_OPERATION_(minus, -);
+    Vc_BINARY_OPERATION_(multiplies, *);
+    Vc_BINARY_OPERATION_(divides, /);
+    Vc_BINARY_OPERATION_(modulus, %);
+    Vc_BINARY_OPERATION_(bit_and, &);
+    Vc_BINARY_OPERATION_(bit_or, |);
+    Vc_BINARY_OPERATION_(bit_xor, ^);
+    Vc_BINARY_OPERATION_(bit_shift_left, <<);
+    Vc_BINARY_OPERATION_(bit_shift_right, >>);
+#undef Vc_BINARY_OPERATION_
+
+    static inline datapar bit_shift_left(const datapar &x, int y)
+    {
+        return {private_init, generate_from_chunks<datapar_member_type>(
+                                  [y](const auto &a) { return a << y; }, x.d)};
+    }
+
+    static inline datapar bit_shift_right(const datapar &x, int y)
+    {
+        return {private_init, generate_from_chunks<datapar_member_type>(
+                                  [y](const auto &a) { return a >> y; }, x.d)};
+    }
+
+    // mulhi {{{2
+    static inline datapar mulhi(const datapar &x, const datapar &y)
+    {
+        return {private_init,
+                generate_from_chunks<datapar_member_type>(
+                    [](const auto &a, const auto &b) {
+                        return get_impl_t<std::decay_t<decltype(a)>>::mulhi(a, b);
+                    },
+                    x.d, y.d)};
+    }
+
+    // fma {{{2
+    static inline datapar fma(const datapar &a, const datapar &b, const datapar &c) noexcept
+    {
+        return {private_init,
+                generate_from_chunks<datapar_member_type>(
+                    [](const auto &x, const auto &y, const auto &z) { return Vc::fma(x, y, z); },
+                    a.d, b.d, c.d)};
+    }
+
+    // add_sat, sub_sat & avg {{{2
+#define Vc_SATURATING_OP_(name_)                                                         \
+    static inline datapar name_(const datapar &x, const datapar &y) noexcept             \
+    {                                                                                    \
+        return {private_init,                                                            \
+                generate_from_chunks<datapar_member_type>(                               \
+                    [](const auto &a, const auto &b) { return Vc::name_(a, b); }, x.d,   \
+                    y.d)};                                                               \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
+    Vc_SATURATING_OP_(add_sat);
+    Vc_SATURATING_OP_(sub_sat);
+    Vc_SATURATING_OP_(avg);
+#undef Vc_SATURATING_OP_
+
+    // increment & decrement{{{2
+    static inline void increment(datapar_member_type &x)
+    {
+        for_each_chunk([](size_t, auto &c) { ++c; }, x);
+    }
+
+    static inline void decrement(datapar_member_type &x)
+    {
+        for_each_chunk([](size_t, auto &c) { --c; }, x);
+    }
+
+    // compares {{{2
+#define Vc_CMP_OPERATIONS(cmp_, op_)                                                     \
+    static inline mask cmp_(const datapar &x, const datapar &y)                          \
+    {                                                                                    \
+        return {private_init,                                                            \
+                generate_from_chunks<mask_member_type>(                                  \
+                    [](const auto &a, const auto &b) { return a op_ b; }, x.d, y.d)};    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+    Vc_CMP_OPERATIONS(equal_to, ==);
+    Vc_CMP_OPERATIONS(not_equal_to, !=);
+    Vc_CMP_OPERATIONS(less, <);
+    Vc_CMP_OPERATIONS(greater, >);
+    Vc_CMP_OPERATIONS(less_equal, <=);
+    Vc_CMP_OPERATIONS(greater_equal, >=);
+#undef Vc_CMP_OPERATIONS
+
+    // smart_reference access {{{2
+    static Vc_INTRINSIC T get(const datapar &v, int i) noexcept { return v.d.get(i); }
+    template <class U> static Vc_INTRINSIC void set(datapar &v, int i, U &&x) noexcept
+    {
+        v.d.set(i, std::forward<U>(x));
+    }
+
+    // masked assignment {{{2
+    static Vc_INTRINSIC void masked_assign(const mask &k, datapar &lhs, const datapar &rhs)
+    {
+        for_each_chunk([](size_t, const auto &kc, auto &c,
+                          const auto &x) { where(kc, c) = x; },
+                       k.d, lhs.d, rhs.d);
+    }
+
+    template <class U>
+    static Vc_INTRINSIC void masked_assign(const mask &k, datapar &lhs, const U &rhs)
+    {
+        for_each_chunk([&](size_t, const auto &kc, auto &c) { where(kc, c) = rhs; }, k.d,
+                       lhs.d);
+    }
+
+    static Vc_INTRINSIC void masked_assign(const mask &k, mask &lhs, const mask &rhs)
+    {
+        for_each_chunk([](size_t, const auto &kc, auto &c,
+                          const auto &x) { where(kc, c) = x; },
+                       k.d, lhs.d, rhs.d);
+    }
+
+    template <template <typename> class Op>
+    static Vc_INTRINSIC void masked_cassign(const mask &k, datapar &lhs, const datapar &rhs)
+    {
+        for_each_chunk([](size_t, const auto &kc, auto &c,
+                          const auto &x) { chunk_masked_cassign<Op>(kc, c, x); },
+                       k.d, lhs.d, rhs.d);
+    }
+
+    template <template <typename> class Op, class U>
+    static Vc_INTRINSIC void masked_cassign(const mask &k, datapar &lhs, const U &rhs)
+    {
+        masked_cassign<Op>(k, lhs, datapar(rhs));
+    }
+
+    template <template <typename> class Op>
+    static Vc_INTRINSIC datapar masked_unary(const mask &k, const datapar &v)
+    {
+        return {private_init, generate_from_chunks<datapar_member_type>(
+                                  [](const auto &kc, const auto &c) {
+                                      return chunk_masked_unary<Op>(kc, c);
+                                  },
+                                  k.d, v.d)};
+    }
+
+private:
+    template <class BinaryOperation>
+    static Vc_INTRINSIC T reduce_rest(T r, const datapar_member_type &x,
+                                      BinaryOperation &binary_op)
+    {
+        return reduce_rest(bool_constant<datapar_member_type::has_rest>(), r, x, binary_op);
+    }
+    template <class BinaryOperation>
+    static Vc_INTRINSIC T reduce_rest(std::false_type, T r, const datapar_member_type &,
+                                      BinaryOperation &)
+    {
+        return r;
+    }
+    template <class BinaryOperation>
+    static Vc_INTRINSIC T reduce_rest(std::true_type, T r, const datapar_member_type &x,
+                                      BinaryOperation &binary_op)
+    {
+        return static_cast<T>(binary_op(r, Vc::reduce(x.rest, binary_op)));
+    }
+    // }}}2
+};
+
+// chunked mask impl {{{1
+template <class T, int N> struct fixed_size_chunked_mask_impl {
+    // member types {{{2
+    using mask_member_type = typename fixed_size_chunked_storage<T, N>::mask_type;
+    using mask = Vc::mask<T, datapar_abi::fixed_size<N>>;
+    using size_tag = std::integral_constant<size_t, N>;
+    using type_tag = T *;
+
+    // broadcast {{{2
+    static inline mask_member_type broadcast(bool x, type_tag) noexcept
+    {
+        mask_member_type r;
+        for_each_chunk(
+            [&](size_t, auto &c) { c = std::decay_t<decltype(c)>(x); }, r);
+        return r;
+    }
+
+    // load {{{2
+    // The bool arrays are converted on load and store anyway. Therefore the chunks use
+    // unaligned access, which also tolerates a bool array that is only aligned to its size.
+    template <class F>
+    static inline mask_member_type load(const bool *mem, F, size_tag) noexcept
+    {
+        mask_member_type r;
+        for_each_chunk(
+            [&](size_t offset, auto &c) { c.memload(mem + offset, flags::element_aligned); },
+            r);
+        return r;
+    }
+
+    // masked load {{{2
+    template <class F>
+    static inline void masked_load(mask_member_type &merge, const mask_member_type &mask,
+                                   const bool *mem, F, size_tag) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, auto &c, const auto &kc) {
+                c.memload(mem + offset, kc, flags::element_aligned);
+            },
+            merge, mask);
+    }
+
+    // store {{{2
+    template <class F>
+    static inline void store(const mask_member_type &v, bool *mem, F, size_tag) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, const auto &c) {
+                c.memstore(mem + offset, flags::element_aligned);
+            },
+            v);
+    }
+
+    // masked store {{{2
+    template <class F>
+    static inline void masked_store(const mask_member_type &v, bool *mem, F,
+                                    const mask_member_type &k, size_tag) noexcept
+    {
+        for_each_chunk(
+            [&](size_t offset, const auto &c, const auto &kc) {
+                c.memstore(mem + offset, kc, flags::element_aligned);
+            },
+            v, k);
+    }
+
+    // negation {{{2
+    static inline mask_member_type negate(const mask_member_type &x, size_tag) noexcept
+    {
+        return generate_from_chunks<mask_member_type>([](const auto &a) { return !a; }, x);
+    }
+
+    // logical and bitwise operators {{{2
+#define Vc_BINARY_OPERATION_(name_, op_)                                                 \
+    static inline mask name_(const mask &x, const mask &y)                               \
+    {                                                                                    \
+        return {private_init,                                                            \
+                generate_from_chunks<mask_member_type>(                                  \
+                    [](const auto &a, const auto &b) { return a op_ b; }, x.d, y.d)};    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+    Vc_BINARY_OPERATION_(logical_and, &&);
+    Vc_BINARY_OPERATION_(logical_or, ||);
+    Vc_BINARY_OPERATION_(bit_and, &);
+    Vc_BINARY_OPERATION_(bit_or, |);
+    Vc_BINARY_OPERATION_(bit_xor, ^);
+#undef Vc_BINARY_OPERATION_
+
+    // smart_reference access {{{2
+    static Vc_INTRINSIC bool get(const mask &k, int i) noexcept { return k.d.get(i); }
+    static Vc_INTRINSIC void set(mask &k, int i, bool x) noexcept { k.d.set(i, x); }
+    // }}}2
+};
+
 // traits {{{1
-template <class T, int N> struct traits<T, datapar_abi::fixed_size<N>> {
+template <class T, int N> struct fixed_size_traits_base {
     static constexpr size_t size() noexcept { return N; }
 
-    using datapar_impl_type = fixed_size_datapar_impl<N>;
-    using datapar_member_type = std::array<T, N>;
     static constexpr size_t datapar_member_alignment =
 #ifdef Vc_GCC
         std::min(size_t(
@@ -508,6 +1352,27 @@ template <class T, int N> struct traits<T, datapar_abi::fixed_size<N>> {
         (
 #endif
                  next_power_of_2(N * sizeof(T)));
+};
+
+template <class T, int N, class ChunkAbi = fixed_size_chunk_abi_t<T, N>>
+struct fixed_size_traits : public fixed_size_traits_base<T, N> {
+    using datapar_impl_type = fixed_size_chunked_datapar_impl<T, N>;
+    using datapar_member_type = typename datapar_impl_type::datapar_member_type;
+    static constexpr size_t datapar_member_alignment =
+        std::max(fixed_size_traits_base<T, N>::datapar_member_alignment,
+                 alignof(datapar_member_type));
+    using datapar_cast_type = const datapar_member_type &;
+
+    using mask_impl_type = fixed_size_chunked_mask_impl<T, N>;
+    using mask_member_type = typename mask_impl_type::mask_member_type;
+    static constexpr size_t mask_member_alignment = alignof(mask_member_type);
+    using mask_cast_type = const mask_member_type &;
+};
+
+template <class T, int N>
+struct fixed_size_traits<T, N, void> : public fixed_size_traits_base<T, N> {
+    using datapar_impl_type = fixed_size_datapar_impl<N>;
+    using datapar_member_type = std::array<T, N>;
     using datapar_cast_type = const datapar_member_type &;
 
     using mask_impl_type = fixed_size_mask_impl<N>;
@@ -516,6 +1381,10 @@ template <class T, int N> struct traits<T, datapar_abi::fixed_size<N>> {
     using mask_cast_type = const mask_member_type &;
 };
 
+template <class T, int N>
+struct traits<T, datapar_abi::fixed_size<N>> : public fixed_size_traits<T, N> {
+};
+
 // }}}1
 }  // namespace detail
 
@@ -526,11 +1395,7 @@ static Vc_INTRINSIC void masked_assign(
     datapar<T, datapar_abi::fixed_size<N>> &lhs,
     const detail::id<datapar<T, datapar_abi::fixed_size<N>>> &rhs)
 {
-    detail::execute_n_times<N>([&](auto i) {
-        if (k[i]) {
-            lhs[i] = rhs[i];
-        }
-    });
+    detail::get_impl_t<datapar<T, datapar_abi::fixed_size<N>>>::masked_assign(k, lhs, rhs);
 }
 
 template <typename T, int N>
@@ -539,11 +1404,7 @@ static Vc_INTRINSIC void masked_assign(
     mask<T, datapar_abi::fixed_size<N>> &lhs,
     const detail::id<mask<T, datapar_abi::fixed_size<N>>> &rhs)
 {
-    detail::execute_n_times<N>([&](auto i) {
-        if (k[i]) {
-            lhs[i] = rhs[i];
-        }
-    });
+    detail::get_impl_t<datapar<T, datapar_abi::fixed_size<N>>>::masked_assign(k, lhs, rhs);
 }
 
 // Optimization for the case where the RHS is a scalar. No need to broadcast the scalar to a datapar
@@ -556,22 +1417,14 @@ static Vc_INTRINSIC
     masked_assign(const mask<T, datapar_abi::fixed_size<N>> &k,
                   datapar<T, datapar_abi::fixed_size<N>> &lhs, const U &rhs)
 {
-    detail::execute_n_times<N>([&](auto i) {
-        if (k[i]) {
-            lhs[i] = rhs;
-        }
-    });
+    detail::get_impl_t<datapar<T, datapar_abi::fixed_size<N>>>::masked_assign(k, lhs, rhs);
 }
 
 template <template <typename> class Op, typename T, int N>
 inline void masked_cassign(const fixed_size_mask<T, N> &k, fixed_size_datapar<T, N> &lhs,
                            const fixed_size_datapar<T, N> &rhs)
 {
-    detail::execute_n_times<N>([&](auto i) {
-        if (k[i]) {
-            lhs[i] = Op<T>{}(lhs[i], rhs[i]);
-        }
-    });
+    detail::get_impl_t<fixed_size_datapar<T, N>>::template masked_cassign<Op>(k, lhs, rhs);
 }
 
 // Optimization for the case where the RHS is a scalar. No need to broadcast the scalar to a datapar
@@ -583,27 +1436,189 @@ inline enable_if<std::is_convertible<U, fixed_size_datapar<T, N>>::value &&
 masked_cassign(const fixed_size_mask<T, N> &k, fixed_size_datapar<T, N> &lhs,
                const U &rhs)
 {
-    detail::execute_n_times<N>([&](auto i) {
-        if (k[i]) {
-            lhs[i] = Op<T>{}(lhs[i], rhs);
-        }
-    });
+    detail::get_impl_t<fixed_size_datapar<T, N>>::template masked_cassign<Op>(k, lhs, rhs);
 }
 
 template <template <typename> class Op, typename T, int N>
 inline fixed_size_datapar<T, N> masked_unary(const fixed_size_mask<T, N> &k,
                                              const fixed_size_datapar<T, N> &v)
 {
-    return static_cast<fixed_size_datapar<T, N>>(
-        detail::generate_from_n_evaluations<N, std::array<T, N>>([&](auto i) {
-            using Vc_VERSIONED_NAMESPACE::detail::data;
-            return data(k)[i] ? Op<T>{}(data(v)[i]) : data(v)[i];
-        }));
+    return detail::get_impl_t<fixed_size_datapar<T, N>>::template masked_unary<Op>(k, v);
 }
 
 // }}}1
 Vc_VERSIONED_NAMESPACE_END
 
+// [mask.reductions] {{{
+#ifdef Vc_HAVE_SSE2
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// The entries of a fixed_size mask are bools, i.e. bytes with value 0 or 1. The reductions
+// therefore process eight entries at once in a 64-bit word, where entry i is bit 8 * i.
+template <int N> using fixed_size_mask_words = std::array<ullong, (N + 7) / 8>;
+
+template <int N>
+Vc_INTRINSIC fixed_size_mask_words<N> mask_words(const std::array<bool, N> &k)
+{
+    fixed_size_mask_words<N> words = {};
+    std::memcpy(words.data(), k.data(), N);
+    return words;
+}
+
+// Returns word i of a mask with all entries set.
+template <int N> constexpr ullong mask_word_all_set(int i)
+{
+    return (N - 8 * i >= 8) ? 0x0101010101010101ull
+                            : 0x0101010101010101ull >> (64 - 8 * (N - 8 * i));
+}
+
+template <size_t N> Vc_INTRINSIC bool all_of(const std::array<bool, N> &k)
+{
+    const auto words = mask_words<int(N)>(k);
+    bool r = true;
+    execute_n_times<int(words.size())>(
+        [&](auto i) { r = r && words[i] == mask_word_all_set<int(N)>(i); });
+    return r;
+}
+
+template <size_t N> Vc_INTRINSIC bool any_of(const std::array<bool, N> &k)
+{
+    const auto words = mask_words<int(N)>(k);
+    ullong r = 0;
+    execute_n_times<int(words.size())>([&](auto i) { r |= words[i]; });
+    return r != 0;
+}
+
+template <size_t N> Vc_INTRINSIC int popcount(const std::array<bool, N> &k)
+{
+    const auto words = mask_words<int(N)>(k);
+    int n = 0;
+    execute_n_times<int(words.size())>([&](auto i) { n += popcnt64(words[i]); });
+    return n;
+}
+
+template <size_t N> Vc_INTRINSIC int find_first_set(const std::array<bool, N> &k)
+{
+    const auto words = mask_words<int(N)>(k);
+    for (int i = 0; i < int(words.size()); ++i) {
+        if (words[i] != 0) {
+            return 8 * i + firstbit(words[i]) / 8;
+        }
+    }
+    return -1;
+}
+
+template <size_t N> Vc_INTRINSIC int find_last_set(const std::array<bool, N> &k)
+{
+    const auto words = mask_words<int(N)>(k);
+    for (int i = int(words.size()) - 1; i >= 0; --i) {
+        if (words[i] != 0) {
+            return 8 * i + lastbit(words[i]) / 8;
+        }
+    }
+    return -1;
+}
+
+// Chunked masks use the reductions of the chunk ABI.
+template <class V, int C, class R>
+Vc_INTRINSIC bool all_of(const fixed_size_chunks<V, C, R> &k)
+{
+    bool r = true;
+    for_each_chunk([&](size_t, const auto &c) { r = r && all_of(c); }, k);
+    return r;
+}
+
+template <class V, int C, class R>
+Vc_INTRINSIC bool any_of(const fixed_size_chunks<V, C, R> &k)
+{
+    bool r = false;
+    for_each_chunk([&](size_t, const auto &c) { r = r || any_of(c); }, k);
+    return r;
+}
+
+template <class V, int C, class R>
+Vc_INTRINSIC int popcount(const fixed_size_chunks<V, C, R> &k)
+{
+    int n = 0;
+    for_each_chunk([&](size_t, const auto &c) { n += popcount(c); }, k);
+    return n;
+}
+
+template <class V, int C, class R>
+Vc_INTRINSIC int find_first_set(const fixed_size_chunks<V, C, R> &k)
+{
+    int r = -1;
+    for_each_chunk(
+        [&](size_t offset, const auto &c) {
+            if (r < 0 && any_of(c)) {
+                r = int(offset) + find_first_set(c);
+            }
+        },
+        k);
+    return r;
+}
+
+template <class V, int C, class R>
+Vc_INTRINSIC int find_last_set(const fixed_size_chunks<V, C, R> &k)
+{
+    int r = -1;
+    for_each_chunk(
+        [&](size_t offset, const auto &c) {
+            if (any_of(c)) {
+                r = int(offset) + find_last_set(c);
+            }
+        },
+        k);
+    return r;
+}
+}  // namespace detail
+
+template <class T, int N>
+Vc_ALWAYS_INLINE bool all_of(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return detail::all_of(detail::data(k));
+}
+
+template <class T, int N>
+Vc_ALWAYS_INLINE bool any_of(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return detail::any_of(detail::data(k));
+}
+
+template <class T, int N>
+Vc_ALWAYS_INLINE bool none_of(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return !any_of(k);
+}
+
+template <class T, int N>
+Vc_ALWAYS_INLINE bool some_of(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return any_of(k) && !all_of(k);
+}
+
+template <class T, int N>
+Vc_ALWAYS_INLINE int popcount(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return detail::popcount(detail::data(k));
+}
+
+template <class T, int N>
+Vc_ALWAYS_INLINE int find_first_set(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return detail::find_first_set(detail::data(k));
+}
+
+template <class T, int N>
+Vc_ALWAYS_INLINE int find_last_set(const mask<T, datapar_abi::fixed_size<N>> &k)
+{
+    return detail::find_last_set(detail::data(k));
+}
+Vc_VERSIONED_NAMESPACE_END
+#endif  // Vc_HAVE_SSE2
+// }}}
+
 namespace std
 {
 // mask operators {{{1
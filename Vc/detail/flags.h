@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_DATAPAR_FLAGS_H_
 
 #include <cstddef>
+#include <type_traits>
 
 Vc_VERSIONED_NAMESPACE_BEGIN
 using size_t = std::size_t;
@@ -48,6 +49,42 @@ template <align_val_t> struct overaligned_tag {};
 constexpr element_aligned_tag element_aligned = {};
 constexpr vector_aligned_tag vector_aligned = {};
 template <align_val_t N> constexpr overaligned_tag<N> overaligned = {};
+
+// Non-temporal loads and stores (movntdqa / movntps), which do not pollute the caches.
+// The memory must be vector-aligned. Streaming stores are weakly ordered; call
+// streaming_fence() before other threads read the data. (non-std)
+struct streaming_tag {};
+constexpr streaming_tag streaming = {};
+
+// Prefetches the cache line Distance bytes after the accessed memory into the cache level
+// Level (1 to 3; 0 prefetches non-temporally), then accesses the memory as Alignment says.
+// Combine with the other flags via |, e.g. vector_aligned | prefetch<512>. (non-std)
+template <size_t Distance, int Level, class Alignment> struct prefetch_tag {
+    static_assert(Level >= 0 && Level <= 3, "the prefetch level must be 0, 1, 2, or 3");
+};
+template <size_t Distance, int Level = 1>
+constexpr prefetch_tag<Distance, Level, element_aligned_tag> prefetch = {};
+
+template <class F> struct is_access_flag : public std::false_type {};
+template <> struct is_access_flag<element_aligned_tag> : public std::true_type {};
+template <> struct is_access_flag<vector_aligned_tag> : public std::true_type {};
+template <align_val_t N> struct is_access_flag<overaligned_tag<N>> : public std::true_type {};
+template <> struct is_access_flag<streaming_tag> : public std::true_type {};
+
+template <class F, size_t Distance, int Level,
+          class = typename std::enable_if<is_access_flag<F>::value>::type>
+constexpr prefetch_tag<Distance, Level, F> operator|(
+    F, prefetch_tag<Distance, Level, element_aligned_tag>)
+{
+    return {};
+}
+template <class F, size_t Distance, int Level,
+          class = typename std::enable_if<is_access_flag<F>::value>::type>
+constexpr prefetch_tag<Distance, Level, F> operator|(
+    prefetch_tag<Distance, Level, element_aligned_tag>, F)
+{
+    return {};
+}
 }  // namespace flags
 Vc_VERSIONED_NAMESPACE_END
 
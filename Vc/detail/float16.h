@@ -0,0 +1,160 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_FLOAT16_H_
+#define VC_DATAPAR_FLOAT16_H_
+
+#include <cstring>
+#include "macros.h"
+#include "detail.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// bit conversions {{{1
+Vc_INTRINSIC uint float_bits(float x)
+{
+    uint r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+Vc_INTRINSIC float bits_to_float(uint x)
+{
+    float r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+// half_to_float / float_to_half {{{1
+// The bit manipulations follow F. Giesen, "half <-> float conversions", 2016. The vector
+// implementations in x86/convert.h use the same steps.
+inline float half_to_float(ushort h)
+{
+    constexpr uint shifted_exp = 0x7c00u << 13;  // exponent mask after the shift
+    uint r = (h & 0x7fffu) << 13;
+    const uint exp = r & shifted_exp;
+    r += (127 - 15) << 23;                       // adjust the exponent bias
+    if (exp == shifted_exp) {                    // infinity or NaN
+        r += (128 - 16) << 23;
+    } else if (exp == 0) {                       // zero or subnormal: renormalize
+        r = float_bits(bits_to_float(r + (1 << 23)) - bits_to_float(113u << 23));
+    }
+    return bits_to_float(r | ((h & 0x8000u) << 16));
+}
+
+// Rounds to nearest, ties to even. NaNs turn into a quiet NaN with the same sign.
+inline ushort float_to_half(float x)
+{
+    constexpr uint f32_infinity = 255u << 23;
+    constexpr uint f16_overflow = (127u + 16) << 23;      // 2^16, the first value to overflow
+    constexpr uint denorm_magic = ((127u - 15) + (23 - 10) + 1) << 23;
+    uint f = float_bits(x);
+    const uint sign = f & 0x80000000u;
+    f ^= sign;
+    uint r;
+    if (f >= f16_overflow) {
+        r = f > f32_infinity ? 0x7e00u : 0x7c00u;
+    } else if (f < (113u << 23)) {  // the result is subnormal or zero
+        // adding 0.5 lets the FPU round the mantissa into the low bits
+        r = float_bits(bits_to_float(f) + bits_to_float(denorm_magic)) - denorm_magic;
+    } else {
+        const uint mant_odd = (f >> 13) & 1;
+        f += ((15u - 127) << 23) + 0xfff;  // rebias the exponent and round
+        f += mant_odd;
+        r = f >> 13;
+    }
+    return static_cast<ushort>(r | (sign >> 16));
+}
+
+// bfloat16_to_float / float_to_bfloat16 {{{1
+inline float bfloat16_to_float(ushort b) { return bits_to_float(uint(b) << 16); }
+
+// Rounds to nearest, ties to even. NaNs stay NaNs by setting the quiet bit.
+inline ushort float_to_bfloat16(float x)
+{
+    const uint f = float_bits(x);
+    if (x != x) {
+        return static_cast<ushort>((f >> 16) | 0x40);
+    }
+    return static_cast<ushort>((f + 0x7fff + ((f >> 16) & 1)) >> 16);
+}
+//}}}1
+}  // namespace detail
+
+// half {{{1
+// IEEE 754 binary16. The type only stores values; they convert to and from float, such that
+// datapar<float> objects can be loaded from and stored to arrays of half. (non-std)
+class half
+{
+public:
+    half() = default;
+    explicit half(float x) : bits_(detail::float_to_half(x)) {}
+    operator float() const { return detail::half_to_float(bits_); }
+
+    static half from_bits(detail::ushort b)
+    {
+        half r;
+        r.bits_ = b;
+        return r;
+    }
+    detail::ushort bits() const { return bits_; }
+
+private:
+    detail::ushort bits_;
+};
+
+// bfloat16 {{{1
+// The upper half of an IEEE 754 binary32, with the exponent range of float but only 8 bits
+// of precision. Otherwise like half. (non-std)
+class bfloat16
+{
+public:
+    bfloat16() = default;
+    explicit bfloat16(float x) : bits_(detail::float_to_bfloat16(x)) {}
+    operator float() const { return detail::bfloat16_to_float(bits_); }
+
+    static bfloat16 from_bits(detail::ushort b)
+    {
+        bfloat16 r;
+        r.bits_ = b;
+        return r;
+    }
+    detail::ushort bits() const { return bits_; }
+
+private:
+    detail::ushort bits_;
+};
+
+static_assert(sizeof(half) == 2 && sizeof(bfloat16) == 2,
+              "half and bfloat16 must have the size of their binary representation");
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_FLOAT16_H_
+
+// vim: foldmethod=marker
@@ -102,6 +102,27 @@ template <class Derived> struct generic_datapar_impl {
     Vc_ARITHMETIC_OP_(bit_shift_right);
 #undef Vc_ARITHMETIC_OP_
 
+    // shifts by a uniform count {{{2
+    template <class T, class A>
+    static Vc_INTRINSIC datapar<T, A> Vc_VDECL bit_shift_left(datapar<T, A> x, int y)
+    {
+        return make_datapar<T, A>(detail::bit_shift_left(adjust_for_long(x.d), y));
+    }
+
+    template <class T, class A>
+    static Vc_INTRINSIC datapar<T, A> Vc_VDECL bit_shift_right(datapar<T, A> x, int y)
+    {
+        return make_datapar<T, A>(detail::bit_shift_right(adjust_for_long(x.d), y));
+    }
+
+    // mulhi {{{2
+    template <class T, class A>
+    static Vc_INTRINSIC datapar<T, A> Vc_VDECL mulhi(datapar<T, A> x, datapar<T, A> y)
+    {
+        using detail::x86::mulhi;
+        return make_datapar<T, A>(mulhi(adjust_for_long(x.d), adjust_for_long(y.d)));
+    }
+
     // sqrt {{{2
     template <class T, class A>
     static Vc_INTRINSIC Vc::datapar<T, A> sqrt(const Vc::datapar<T, A> &x) noexcept
@@ -110,6 +131,57 @@ template <class Derived> struct generic_datapar_impl {
         return make_datapar<T, A>(sqrt(adjust_for_long(detail::data(x))));
     }
 
+    // fma {{{2
+    template <class T, class A>
+    static Vc_INTRINSIC Vc::datapar<T, A> fma(const Vc::datapar<T, A> &a,
+                                             const Vc::datapar<T, A> &b,
+                                             const Vc::datapar<T, A> &c) noexcept
+    {
+        using detail::x86::fma;
+        return make_datapar<T, A>(
+            fma(detail::data(a), detail::data(b), detail::data(c)));
+    }
+
+    // add_sat, sub_sat & avg {{{2
+#define Vc_SATURATING_OP_(name_)                                                         \
+    template <class T, class A>                                                          \
+    static Vc_INTRINSIC Vc::datapar<T, A> name_(const Vc::datapar<T, A> &x,              \
+                                                const Vc::datapar<T, A> &y) noexcept     \
+    {                                                                                    \
+        using detail::x86::name_;                                                        \
+        return make_datapar<T, A>(name_(detail::data(x), detail::data(y)));              \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
+    Vc_SATURATING_OP_(add_sat);
+    Vc_SATURATING_OP_(sub_sat);
+    Vc_SATURATING_OP_(avg);
+#undef Vc_SATURATING_OP_
+
+    // exponent {{{2
+    template <class T, class A>
+    static Vc_INTRINSIC Vc::datapar<T, A> exponent(const Vc::datapar<T, A> &x) noexcept
+    {
+        using detail::x86::exponent;
+        return make_datapar<T, A>(exponent(detail::data(x)));
+    }
+
+    // fraction {{{2
+    template <class T, class A>
+    static Vc_INTRINSIC Vc::datapar<T, A> fraction(const Vc::datapar<T, A> &x) noexcept
+    {
+        using detail::x86::fraction;
+        return make_datapar<T, A>(fraction(detail::data(x)));
+    }
+
+    // exp2_integral {{{2
+    template <class T, class A>
+    static Vc_INTRINSIC Vc::datapar<T, A> exp2_integral(const Vc::datapar<T, A> &n) noexcept
+    {
+        using detail::x86::exp2_integral;
+        return make_datapar<T, A>(exp2_integral(detail::data(n)));
+    }
+
     // abs {{{2
     template <class T, class A>
     static Vc_INTRINSIC Vc::datapar<T, A> abs(const Vc::datapar<T, A> &x) noexcept
@@ -0,0 +1,678 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_INTERLEAVE_H_
+#define VC_DATAPAR_INTERLEAVE_H_
+
+#include "synopsis.h"
+#include "permute.h"
+#include <array>
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+#ifdef Vc_HAVE_SSE2
+namespace x86
+{
+// lane_entry {{{1
+// Structures of 16 bytes are transposed with float or double shuffles, one 128-bit lane
+// at a time. lane_entry maps the register type to the entry type of those shuffles.
+template <class W> struct lane_entry;
+template <> struct lane_entry<__m128> { using type = float; };
+template <> struct lane_entry<__m128d> { using type = double; };
+#ifdef Vc_HAVE_AVX
+template <> struct lane_entry<__m256> { using type = float; };
+template <> struct lane_entry<__m256d> { using type = double; };
+#endif  // Vc_HAVE_AVX
+template <class W, class T>
+using if_lanes_of = enable_if<std::is_same<typename lane_entry<W>::type, T>::value, void>;
+
+// loadu / storeu {{{1
+Vc_INTRINSIC void loadu(__m128 &r, const void *p) { r = _mm_loadu_ps(static_cast<const float *>(p)); }
+Vc_INTRINSIC void loadu(__m128d &r, const void *p) { r = _mm_loadu_pd(static_cast<const double *>(p)); }
+Vc_INTRINSIC void storeu(void *p, __m128 v) { _mm_storeu_ps(static_cast<float *>(p), v); }
+Vc_INTRINSIC void storeu(void *p, __m128d v) { _mm_storeu_pd(static_cast<double *>(p), v); }
+#ifdef Vc_HAVE_AVX
+Vc_INTRINSIC void loadu(__m256 &r, const void *p) { r = _mm256_loadu_ps(static_cast<const float *>(p)); }
+Vc_INTRINSIC void loadu(__m256d &r, const void *p) { r = _mm256_loadu_pd(static_cast<const double *>(p)); }
+Vc_INTRINSIC void storeu(void *p, __m256 v) { _mm256_storeu_ps(static_cast<float *>(p), v); }
+Vc_INTRINSIC void storeu(void *p, __m256d v) { _mm256_storeu_pd(static_cast<double *>(p), v); }
+#endif  // Vc_HAVE_AVX
+
+// in-lane shuffles {{{1
+template <int Imm> Vc_INTRINSIC __m128 shuffle_lanes(__m128 a, __m128 b) { return _mm_shuffle_ps(a, b, Imm); }
+template <int Imm> Vc_INTRINSIC __m128d shuffle_lanes(__m128d a, __m128d b) { return _mm_shuffle_pd(a, b, Imm); }
+Vc_INTRINSIC __m128 unpacklo(__m128 a, __m128 b) { return _mm_unpacklo_ps(a, b); }
+Vc_INTRINSIC __m128d unpacklo(__m128d a, __m128d b) { return _mm_unpacklo_pd(a, b); }
+Vc_INTRINSIC __m128 unpackhi(__m128 a, __m128 b) { return _mm_unpackhi_ps(a, b); }
+Vc_INTRINSIC __m128d unpackhi(__m128d a, __m128d b) { return _mm_unpackhi_pd(a, b); }
+#ifdef Vc_HAVE_AVX
+template <int Imm> Vc_INTRINSIC __m256 shuffle_lanes(__m256 a, __m256 b) { return _mm256_shuffle_ps(a, b, Imm); }
+template <int Imm> Vc_INTRINSIC __m256d shuffle_lanes(__m256d a, __m256d b) { return _mm256_shuffle_pd(a, b, Imm | Imm << 2); }
+Vc_INTRINSIC __m256 unpacklo(__m256 a, __m256 b) { return _mm256_unpacklo_ps(a, b); }
+Vc_INTRINSIC __m256d unpacklo(__m256d a, __m256d b) { return _mm256_unpacklo_pd(a, b); }
+Vc_INTRINSIC __m256 unpackhi(__m256 a, __m256 b) { return _mm256_unpackhi_ps(a, b); }
+Vc_INTRINSIC __m256d unpackhi(__m256d a, __m256d b) { return _mm256_unpackhi_pd(a, b); }
+#endif  // Vc_HAVE_AVX
+
+// deinterleave_lanes / interleave_lanes (float) {{{1
+// Converts between structure order ({x0 y0 x1 y1}, ...) and member order ({x0 x1 x2 x3},
+// ...) within every 128-bit lane.
+template <class W> Vc_INTRINSIC if_lanes_of<W, float> deinterleave_lanes(std::array<W, 2> &v)
+{
+    const W a = v[0], b = v[1];
+    v[0] = shuffle_lanes<_MM_SHUFFLE(2, 0, 2, 0)>(a, b);
+    v[1] = shuffle_lanes<_MM_SHUFFLE(3, 1, 3, 1)>(a, b);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, float> interleave_lanes(std::array<W, 2> &v)
+{
+    const W x = v[0], y = v[1];
+    v[0] = unpacklo(x, y);
+    v[1] = unpackhi(x, y);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, float> deinterleave_lanes(std::array<W, 3> &v)
+{
+    // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    const W a = v[0], b = v[1], c = v[2];
+    const W x2y2x3y3 = shuffle_lanes<_MM_SHUFFLE(2, 1, 3, 2)>(b, c);
+    const W y0z0y1z1 = shuffle_lanes<_MM_SHUFFLE(1, 0, 2, 1)>(a, b);
+    v[0] = shuffle_lanes<_MM_SHUFFLE(2, 0, 3, 0)>(a, x2y2x3y3);
+    v[1] = shuffle_lanes<_MM_SHUFFLE(3, 1, 2, 0)>(y0z0y1z1, x2y2x3y3);
+    v[2] = shuffle_lanes<_MM_SHUFFLE(3, 0, 3, 1)>(y0z0y1z1, c);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, float> interleave_lanes(std::array<W, 3> &v)
+{
+    const W x = v[0], y = v[1], z = v[2];
+    const W x0y0x1y1 = unpacklo(x, y);
+    const W x2y2x3y3 = unpackhi(x, y);
+    const W z0z0x1x1 = shuffle_lanes<_MM_SHUFFLE(2, 2, 0, 0)>(z, x0y0x1y1);
+    const W y1y1z1z1 = shuffle_lanes<_MM_SHUFFLE(1, 1, 3, 3)>(x0y0x1y1, z);
+    const W z2z2x3x3 = shuffle_lanes<_MM_SHUFFLE(2, 2, 2, 2)>(z, x2y2x3y3);
+    const W y3y3z3z3 = shuffle_lanes<_MM_SHUFFLE(3, 3, 3, 3)>(x2y2x3y3, z);
+    v[0] = shuffle_lanes<_MM_SHUFFLE(2, 0, 1, 0)>(x0y0x1y1, z0z0x1x1);
+    v[1] = shuffle_lanes<_MM_SHUFFLE(1, 0, 2, 0)>(y1y1z1z1, x2y2x3y3);
+    v[2] = shuffle_lanes<_MM_SHUFFLE(2, 0, 2, 0)>(z2z2x3x3, y3y3z3z3);
+}
+
+// 4x4 transpose; it is its own inverse
+template <class W> Vc_INTRINSIC if_lanes_of<W, float> deinterleave_lanes(std::array<W, 4> &v)
+{
+    const W t0 = unpacklo(v[0], v[1]);
+    const W t1 = unpacklo(v[2], v[3]);
+    const W t2 = unpackhi(v[0], v[1]);
+    const W t3 = unpackhi(v[2], v[3]);
+    v[0] = shuffle_lanes<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+    v[1] = shuffle_lanes<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+    v[2] = shuffle_lanes<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+    v[3] = shuffle_lanes<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, float> interleave_lanes(std::array<W, 4> &v)
+{
+    deinterleave_lanes(v);
+}
+
+// deinterleave_lanes / interleave_lanes (double) {{{1
+// 2x2 transpose; it is its own inverse
+template <class W> Vc_INTRINSIC if_lanes_of<W, double> deinterleave_lanes(std::array<W, 2> &v)
+{
+    const W a = v[0], b = v[1];
+    v[0] = unpacklo(a, b);
+    v[1] = unpackhi(a, b);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, double> interleave_lanes(std::array<W, 2> &v)
+{
+    deinterleave_lanes(v);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, double> deinterleave_lanes(std::array<W, 3> &v)
+{
+    // a = x0 y0, b = z0 x1, c = y1 z1
+    const W a = v[0], b = v[1], c = v[2];
+    v[0] = shuffle_lanes<2>(a, b);
+    v[1] = shuffle_lanes<1>(a, c);
+    v[2] = shuffle_lanes<2>(b, c);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, double> interleave_lanes(std::array<W, 3> &v)
+{
+    const W x = v[0], y = v[1], z = v[2];
+    v[0] = shuffle_lanes<0>(x, y);
+    v[1] = shuffle_lanes<2>(z, x);
+    v[2] = shuffle_lanes<3>(y, z);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, double> deinterleave_lanes(std::array<W, 4> &v)
+{
+    // a = x0 y0, b = z0 w0, c = x1 y1, d = z1 w1
+    const W a = v[0], b = v[1], c = v[2], d = v[3];
+    v[0] = unpacklo(a, c);
+    v[1] = unpackhi(a, c);
+    v[2] = unpacklo(b, d);
+    v[3] = unpackhi(b, d);
+}
+
+template <class W> Vc_INTRINSIC if_lanes_of<W, double> interleave_lanes(std::array<W, 4> &v)
+{
+    const W x = v[0], y = v[1], z = v[2], w = v[3];
+    v[0] = unpacklo(x, y);
+    v[1] = unpacklo(z, w);
+    v[2] = unpackhi(x, y);
+    v[3] = unpackhi(z, w);
+}
+
+// lanes_from_memory / lanes_to_memory {{{1
+// The in-lane kernels need the 128-bit lanes of one kernel invocation in the same lane of
+// consecutive registers. For SSE registers this is the memory order already; AVX registers
+// are regrouped so that the low lanes hold the first half of the structures.
+template <class W, size_t M>
+Vc_INTRINSIC enable_if<sizeof(W) == 16, void> lanes_from_memory(std::array<W, M> &)
+{
+}
+template <class W, size_t M>
+Vc_INTRINSIC enable_if<sizeof(W) == 16, void> lanes_to_memory(std::array<W, M> &)
+{
+}
+
+#ifdef Vc_HAVE_AVX
+template <int Imm> Vc_INTRINSIC __m256 permute_lanes(__m256 a, __m256 b) { return _mm256_permute2f128_ps(a, b, Imm); }
+template <int Imm> Vc_INTRINSIC __m256d permute_lanes(__m256d a, __m256d b) { return _mm256_permute2f128_pd(a, b, Imm); }
+// low lane of a, high lane of b
+Vc_INTRINSIC __m256 lo_hi(__m256 a, __m256 b) { return _mm256_blend_ps(a, b, 0xf0); }
+Vc_INTRINSIC __m256d lo_hi(__m256d a, __m256d b) { return _mm256_blend_pd(a, b, 0xc); }
+
+template <class W> Vc_INTRINSIC enable_if<sizeof(W) == 32, void> lanes_from_memory(std::array<W, 2> &v)
+{
+    const W a = v[0], b = v[1];
+    v[0] = permute_lanes<0x20>(a, b);
+    v[1] = permute_lanes<0x31>(a, b);
+}
+
+template <class W> Vc_INTRINSIC enable_if<sizeof(W) == 32, void> lanes_to_memory(std::array<W, 2> &v)
+{
+    lanes_from_memory(v);
+}
+
+template <class W> Vc_INTRINSIC enable_if<sizeof(W) == 32, void> lanes_from_memory(std::array<W, 3> &v)
+{
+    const W a = v[0], b = v[1], c = v[2];
+    v[0] = lo_hi(a, b);
+    v[1] = permute_lanes<0x21>(a, c);
+    v[2] = lo_hi(b, c);
+}
+
+template <class W> Vc_INTRINSIC enable_if<sizeof(W) == 32, void> lanes_to_memory(std::array<W, 3> &v)
+{
+    const W a = v[0], b = v[1], c = v[2];
+    v[0] = permute_lanes<0x20>(a, b);
+    v[1] = lo_hi(c, a);
+    v[2] = permute_lanes<0x31>(b, c);
+}
+
+template <class W> Vc_INTRINSIC enable_if<sizeof(W) == 32, void> lanes_from_memory(std::array<W, 4> &v)
+{
+    const W a = v[0], b = v[1], c = v[2], d = v[3];
+    v[0] = permute_lanes<0x20>(a, c);
+    v[1] = permute_lanes<0x31>(a, c);
+    v[2] = permute_lanes<0x20>(b, d);
+    v[3] = permute_lanes<0x31>(b, d);
+}
+
+template <class W> Vc_INTRINSIC enable_if<sizeof(W) == 32, void> lanes_to_memory(std::array<W, 4> &v)
+{
+    const W a = v[0], b = v[1], c = v[2], d = v[3];
+    v[0] = permute_lanes<0x20>(a, b);
+    v[1] = permute_lanes<0x20>(c, d);
+    v[2] = permute_lanes<0x31>(a, b);
+    v[3] = permute_lanes<0x31>(c, d);
+}
+#endif  // Vc_HAVE_AVX
+
+// load_struct_lanes / store_struct_lanes {{{1
+// For 16-byte structures at arbitrary offsets: register j holds structure j in its low lane
+// and, for AVX, structure j + M in its high lane.
+template <size_t M, class T, class I, class IA>
+Vc_INTRINSIC void load_struct_lanes(std::array<__m128, M> &v, const T *mem,
+                                    const datapar<I, IA> &offsets)
+{
+    for (size_t j = 0; j < M; ++j) {
+        loadu(v[j], mem + offsets[j]);
+    }
+}
+template <size_t M, class T, class I, class IA>
+Vc_INTRINSIC void load_struct_lanes(std::array<__m128d, M> &v, const T *mem,
+                                    const datapar<I, IA> &offsets)
+{
+    for (size_t j = 0; j < M; ++j) {
+        loadu(v[j], mem + offsets[j]);
+    }
+}
+template <size_t M, class T, class I, class IA>
+Vc_INTRINSIC void store_struct_lanes(const std::array<__m128, M> &v, T *mem,
+                                     const datapar<I, IA> &offsets)
+{
+    for (size_t j = 0; j < M; ++j) {
+        storeu(mem + offsets[j], v[j]);
+    }
+}
+template <size_t M, class T, class I, class IA>
+Vc_INTRINSIC void store_struct_lanes(const std::array<__m128d, M> &v, T *mem,
+                                     const datapar<I, IA> &offsets)
+{
+    for (size_t j = 0; j < M; ++j) {
+        storeu(mem + offsets[j], v[j]);
+    }
+}
+
+#ifdef Vc_HAVE_AVX
+template <size_t M, class W, class T, class I, class IA>
+Vc_INTRINSIC enable_if<sizeof(W) == 32, void> load_struct_lanes(std::array<W, M> &v, const T *mem,
+                                                          const datapar<I, IA> &offsets)
+{
+    for (size_t j = 0; j < M; ++j) {
+        decltype(lo128(v[j])) lo, hi;
+        loadu(lo, mem + offsets[j]);
+        loadu(hi, mem + offsets[j + M]);
+        v[j] = concat(lo, hi);
+    }
+}
+template <size_t M, class W, class T, class I, class IA>
+Vc_INTRINSIC enable_if<sizeof(W) == 32, void> store_struct_lanes(const std::array<W, M> &v, T *mem,
+                                                           const datapar<I, IA> &offsets)
+{
+    for (size_t j = 0; j < M; ++j) {
+        storeu(mem + offsets[j], lo128(v[j]));
+        storeu(mem + offsets[j + M], hi128(v[j]));
+    }
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+// permutex2var {{{1
+Vc_INTRINSIC __m512i permutex2var(size_constant<4>, __m512i a, __m512i idx, __m512i b)
+{
+    return _mm512_permutex2var_epi32(a, idx, b);
+}
+Vc_INTRINSIC __m512i permutex2var(size_constant<8>, __m512i a, __m512i idx, __m512i b)
+{
+    return _mm512_permutex2var_epi64(a, idx, b);
+}
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i permutex2var(size_constant<2>, __m512i a, __m512i idx, __m512i b)
+{
+    return _mm512_permutex2var_epi16(a, idx, b);
+}
+#endif  // Vc_HAVE_AVX512BW
+
+// permutex2var_chain {{{1
+// For every output register r and step s (1 <= s < M), entry i of index[r][s] selects
+// either from the result of step s - 1 (step 0 being input register 0) or from input
+// register s. M - 1 vpermt2* instructions therefore produce each output register.
+template <class I, size_t M, size_t N> struct permutex2var_chain {
+    struct table {
+        alignas(64) I index[M][M][N];
+    };
+
+    // output register m holds member m; entry k is memory entry k * M + m
+    static constexpr table make_deinterleave()
+    {
+        table t{};
+        for (size_t m = 0; m < M; ++m) {
+            for (size_t s = 1; s < M; ++s) {
+                for (size_t k = 0; k < N; ++k) {
+                    const size_t j = (k * M + m) / N;
+                    const size_t e = (k * M + m) % N;
+                    t.index[m][s][k] = I(j == s ? N + e : s == 1 ? e : k);
+                }
+            }
+        }
+        return t;
+    }
+
+    // output register q holds memory entries [q * N, (q + 1) * N)
+    static constexpr table make_interleave()
+    {
+        table t{};
+        for (size_t q = 0; q < M; ++q) {
+            for (size_t s = 1; s < M; ++s) {
+                for (size_t e = 0; e < N; ++e) {
+                    const size_t k = (q * N + e) / M;
+                    const size_t m = (q * N + e) % M;
+                    t.index[q][s][e] = I(m == s ? N + k : s == 1 ? k : e);
+                }
+            }
+        }
+        return t;
+    }
+
+    static constexpr table deinterleave = make_deinterleave();
+    static constexpr table interleave = make_interleave();
+
+    static Vc_INTRINSIC void apply(const table &t, std::array<__m512i, M> &v)
+    {
+        const std::array<__m512i, M> in = v;
+        for (size_t r = 0; r < M; ++r) {
+            __m512i tmp = in[0];
+            for (size_t s = 1; s < M; ++s) {
+                tmp = permutex2var(size_tag<sizeof(I)>, tmp,
+                                   _mm512_load_si512(&t.index[r][s][0]), in[s]);
+            }
+            v[r] = tmp;
+        }
+    }
+};
+template <class I, size_t M, size_t N>
+constexpr typename permutex2var_chain<I, M, N>::table permutex2var_chain<I, M, N>::deinterleave;
+template <class I, size_t M, size_t N>
+constexpr typename permutex2var_chain<I, M, N>::table permutex2var_chain<I, M, N>::interleave;
+#endif  // Vc_HAVE_AVX512F
+//}}}1
+}  // namespace x86
+#endif  // Vc_HAVE_SSE2
+
+// interleaved_load_impl {{{1
+// The generic case loads every member with a strided generator.
+template <class T, class A, size_t M>
+Vc_INTRINSIC void interleaved_load_impl(const T *mem, const std::array<datapar<T, A> *, M> &vs)
+{
+    using V = datapar<T, A>;
+    for (size_t m = 0; m < M; ++m) {
+        *vs[m] = V([&](auto i) -> T { return mem[i * M + m]; });
+    }
+}
+
+template <class T, class A, size_t M>
+Vc_INTRINSIC void interleaved_store_impl(T *mem,
+                                         const std::array<const datapar<T, A> *, M> &vs)
+{
+    for (size_t m = 0; m < M; ++m) {
+        for (size_t i = 0; i < datapar_size_v<T, A>; ++i) {
+            mem[i * M + m] = (*vs[m])[i];
+        }
+    }
+}
+
+template <class T, class A, class I, class IA, size_t M>
+Vc_INTRINSIC void interleaved_gather_impl(const T *mem, const datapar<I, IA> &offsets,
+                                          const std::array<datapar<T, A> *, M> &vs)
+{
+    for (size_t m = 0; m < M; ++m) {
+        vs[m]->gather(mem + m, offsets);
+    }
+}
+
+template <class T, class A, class I, class IA, size_t M>
+Vc_INTRINSIC void interleaved_scatter_impl(T *mem, const datapar<I, IA> &offsets,
+                                           const std::array<const datapar<T, A> *, M> &vs)
+{
+    for (size_t m = 0; m < M; ++m) {
+        vs[m]->scatter(mem + m, offsets);
+    }
+}
+
+#ifdef Vc_HAVE_SSE2
+// lane transposes for SSE and AVX {{{1
+template <class T, class A>
+using lane_register =
+    x86::intrinsic_type<std::conditional_t<sizeof(T) == 4, float, double>, datapar_size_v<T, A>>;
+
+template <class T, size_t M>
+constexpr bool has_lane_transpose = (sizeof(T) == 4 || sizeof(T) == 8) && M >= 2 && M <= 4;
+
+template <class T, class A, size_t M>
+Vc_INTRINSIC void lane_interleaved_load(const T *mem, const std::array<datapar<T, A> *, M> &vs)
+{
+    using V = datapar<T, A>;
+    std::array<lane_register<T, A>, M> v;
+    for (size_t j = 0; j < M; ++j) {
+        x86::loadu(v[j], mem + j * V::size());
+    }
+    x86::lanes_from_memory(v);
+    x86::deinterleave_lanes(v);
+    for (size_t m = 0; m < M; ++m) {
+        *vs[m] = V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(v[m]));
+    }
+}
+
+template <class T, class A, size_t M>
+Vc_INTRINSIC void lane_interleaved_store(T *mem,
+                                         const std::array<const datapar<T, A> *, M> &vs)
+{
+    using V = datapar<T, A>;
+    std::array<lane_register<T, A>, M> v;
+    for (size_t m = 0; m < M; ++m) {
+        v[m] = x86::intrin_cast<lane_register<T, A>>(data(*vs[m]).v());
+    }
+    x86::interleave_lanes(v);
+    x86::lanes_to_memory(v);
+    for (size_t j = 0; j < M; ++j) {
+        x86::storeu(mem + j * V::size(), v[j]);
+    }
+}
+
+// A structure of 16 bytes fills one lane, so it is loaded with a single instruction.
+template <class T, class A, class I, class IA, size_t M>
+Vc_INTRINSIC void lane_interleaved_gather(const T *mem, const datapar<I, IA> &offsets,
+                                          const std::array<datapar<T, A> *, M> &vs)
+{
+    using V = datapar<T, A>;
+    std::array<lane_register<T, A>, M> v;
+    x86::load_struct_lanes(v, mem, offsets);
+    x86::deinterleave_lanes(v);
+    for (size_t m = 0; m < M; ++m) {
+        *vs[m] = V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(v[m]));
+    }
+}
+
+template <class T, class A, class I, class IA, size_t M>
+Vc_INTRINSIC void lane_interleaved_scatter(T *mem, const datapar<I, IA> &offsets,
+                                           const std::array<const datapar<T, A> *, M> &vs)
+{
+    std::array<lane_register<T, A>, M> v;
+    for (size_t m = 0; m < M; ++m) {
+        v[m] = x86::intrin_cast<lane_register<T, A>>(data(*vs[m]).v());
+    }
+    x86::interleave_lanes(v);
+    x86::store_struct_lanes(v, mem, offsets);
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_SSE_ABI
+template <class T, size_t M>
+Vc_INTRINSIC enable_if<has_lane_transpose<T, M>, void> interleaved_load_impl(
+    const T *mem, const std::array<datapar<T, datapar_abi::sse> *, M> &vs)
+{
+    lane_interleaved_load(mem, vs);
+}
+
+template <class T, size_t M>
+Vc_INTRINSIC enable_if<has_lane_transpose<T, M>, void> interleaved_store_impl(
+    T *mem, const std::array<const datapar<T, datapar_abi::sse> *, M> &vs)
+{
+    lane_interleaved_store(mem, vs);
+}
+
+template <class T, class I, class IA, size_t M>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 || sizeof(T) == 8) && sizeof(T) * M == 16, void> interleaved_gather_impl(
+    const T *mem, const datapar<I, IA> &offsets,
+    const std::array<datapar<T, datapar_abi::sse> *, M> &vs)
+{
+    lane_interleaved_gather(mem, offsets, vs);
+}
+
+template <class T, class I, class IA, size_t M>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 || sizeof(T) == 8) && sizeof(T) * M == 16, void> interleaved_scatter_impl(
+    T *mem, const datapar<I, IA> &offsets,
+    const std::array<const datapar<T, datapar_abi::sse> *, M> &vs)
+{
+    lane_interleaved_scatter(mem, offsets, vs);
+}
+#endif  // Vc_HAVE_SSE_ABI
+
+#ifdef Vc_HAVE_AVX_ABI
+template <class T, size_t M>
+Vc_INTRINSIC enable_if<has_lane_transpose<T, M>, void> interleaved_load_impl(
+    const T *mem, const std::array<datapar<T, datapar_abi::avx> *, M> &vs)
+{
+    lane_interleaved_load(mem, vs);
+}
+
+template <class T, size_t M>
+Vc_INTRINSIC enable_if<has_lane_transpose<T, M>, void> interleaved_store_impl(
+    T *mem, const std::array<const datapar<T, datapar_abi::avx> *, M> &vs)
+{
+    lane_interleaved_store(mem, vs);
+}
+
+template <class T, class I, class IA, size_t M>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 || sizeof(T) == 8) && sizeof(T) * M == 16, void> interleaved_gather_impl(
+    const T *mem, const datapar<I, IA> &offsets,
+    const std::array<datapar<T, datapar_abi::avx> *, M> &vs)
+{
+    lane_interleaved_gather(mem, offsets, vs);
+}
+
+template <class T, class I, class IA, size_t M>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 || sizeof(T) == 8) && sizeof(T) * M == 16, void> interleaved_scatter_impl(
+    T *mem, const datapar<I, IA> &offsets,
+    const std::array<const datapar<T, datapar_abi::avx> *, M> &vs)
+{
+    lane_interleaved_scatter(mem, offsets, vs);
+}
+#endif  // Vc_HAVE_AVX_ABI
+
+#ifdef Vc_HAVE_AVX512_ABI
+// vpermt2* chains for AVX-512 {{{1
+template <class T>
+using permutex2var_index = std::conditional_t<
+    sizeof(T) == 2, short, std::conditional_t<sizeof(T) == 4, int, llong>>;
+
+template <class T, size_t M>
+constexpr bool has_permutex2var_chain = M >= 2 && (sizeof(T) == 4 || sizeof(T) == 8
+#ifdef Vc_HAVE_AVX512BW
+                                                   || sizeof(T) == 2
+#endif  // Vc_HAVE_AVX512BW
+                                                   );
+
+template <class T, size_t M>
+Vc_INTRINSIC enable_if<has_permutex2var_chain<T, M>, void> interleaved_load_impl(
+    const T *mem, const std::array<datapar<T, datapar_abi::avx512> *, M> &vs)
+{
+    using V = datapar<T, datapar_abi::avx512>;
+    using Chain = x86::permutex2var_chain<permutex2var_index<T>, M, V::size()>;
+    std::array<__m512i, M> v;
+    for (size_t j = 0; j < M; ++j) {
+        v[j] = _mm512_loadu_si512(mem + j * V::size());
+    }
+    Chain::apply(Chain::deinterleave, v);
+    for (size_t m = 0; m < M; ++m) {
+        *vs[m] = V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(v[m]));
+    }
+}
+
+template <class T, size_t M>
+Vc_INTRINSIC enable_if<has_permutex2var_chain<T, M>, void> interleaved_store_impl(
+    T *mem, const std::array<const datapar<T, datapar_abi::avx512> *, M> &vs)
+{
+    using V = datapar<T, datapar_abi::avx512>;
+    using Chain = x86::permutex2var_chain<permutex2var_index<T>, M, V::size()>;
+    std::array<__m512i, M> v;
+    for (size_t m = 0; m < M; ++m) {
+        v[m] = x86::intrin_cast<__m512i>(data(*vs[m]).v());
+    }
+    Chain::apply(Chain::interleave, v);
+    for (size_t j = 0; j < M; ++j) {
+        _mm512_storeu_si512(mem + j * V::size(), v[j]);
+    }
+}
+#endif  // Vc_HAVE_AVX512_ABI
+//}}}1
+}  // namespace detail
+
+// interleaved_load {{{1
+// Loads datapar_size_v<T, A> consecutive structures with one member per argument from mem.
+// Member m of structure i is stored to entry i of the m-th argument. (non-std)
+template <class T, class A, class... Vs>
+Vc_INTRINSIC enable_if<(sizeof...(Vs) > 0) &&
+                       conjunction<std::is_same<datapar<T, A>, Vs>...>::value, void>
+interleaved_load(const T *mem, datapar<T, A> &v0, Vs &... vs)
+{
+    detail::interleaved_load_impl(
+        mem, std::array<datapar<T, A> *, 1 + sizeof...(Vs)>{{&v0, &vs...}});
+}
+
+// interleaved_store {{{1
+// The inverse of interleaved_load. (non-std)
+template <class T, class A, class... Vs>
+Vc_INTRINSIC enable_if<(sizeof...(Vs) > 0) &&
+                       conjunction<std::is_same<datapar<T, A>, Vs>...>::value, void>
+interleaved_store(T *mem, const datapar<T, A> &v0, const Vs &... vs)
+{
+    detail::interleaved_store_impl(
+        mem, std::array<const datapar<T, A> *, 1 + sizeof...(Vs)>{{&v0, &vs...}});
+}
+
+// interleaved_gather {{{1
+// Like interleaved_load, but structure i is read from mem + indexes[i] * (number of
+// members). (non-std)
+template <class T, class A, class I, class IA, class... Vs>
+Vc_INTRINSIC enable_if<(sizeof...(Vs) > 0) &&
+                       conjunction<std::is_same<datapar<T, A>, Vs>...>::value, void>
+interleaved_gather(const T *mem, const datapar<I, IA> &indexes, datapar<T, A> &v0,
+                   Vs &... vs)
+{
+    static_assert(std::is_integral<I>::value && datapar_size_v<I, IA> == datapar_size_v<T, A>,
+                  "gathers require an integral index vector of equal size");
+    detail::interleaved_gather_impl(
+        mem, indexes * I(1 + sizeof...(Vs)),
+        std::array<datapar<T, A> *, 1 + sizeof...(Vs)>{{&v0, &vs...}});
+}
+
+// interleaved_scatter {{{1
+// The inverse of interleaved_gather. The indexes must be unique. (non-std)
+template <class T, class A, class I, class IA, class... Vs>
+Vc_INTRINSIC enable_if<(sizeof...(Vs) > 0) &&
+                       conjunction<std::is_same<datapar<T, A>, Vs>...>::value, void>
+interleaved_scatter(T *mem, const datapar<I, IA> &indexes, const datapar<T, A> &v0,
+                    const Vs &... vs)
+{
+    static_assert(std::is_integral<I>::value && datapar_size_v<I, IA> == datapar_size_v<T, A>,
+                  "scatters require an integral index vector of equal size");
+    detail::interleaved_scatter_impl(
+        mem, indexes * I(1 + sizeof...(Vs)),
+        std::array<const datapar<T, A> *, 1 + sizeof...(Vs)>{{&v0, &vs...}});
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_INTERLEAVE_H_
+
+// vim: foldmethod=marker
@@ -96,6 +96,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef __AVX__
 #define Vc_HAVE_AVX
 #endif
+#ifdef __FMA__
+#define Vc_HAVE_FMA
+#endif
+#ifdef __FMA4__
+#define Vc_HAVE_FMA4
+#endif
+#ifdef __F16C__
+#define Vc_HAVE_F16C
+#endif
 #ifdef __AVX2__
 #define Vc_HAVE_AVX2
 #define Vc_HAVE_BMI1
@@ -125,6 +134,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef __AVX512BW__
 #define Vc_HAVE_AVX512BW
 #endif
+#ifdef __AVX512VBMI2__
+#define Vc_HAVE_AVX512VBMI2
+#endif
 #ifdef __MIC__
 #define Vc_HAVE_KNC
 #endif
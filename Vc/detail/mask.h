@@ -72,9 +72,10 @@ public:
     mask(const mask<U, datapar_abi::fixed_size<size_v>> &x,
          enable_if<conjunction<std::is_same<abi_type, datapar_abi::fixed_size<size_v>>,
                                std::is_same<U, U>>::value> = nullarg)
-        : mask{static_cast<const std::array<bool, size()> &>(x).data(),
-               flags::vector_aligned}
     {
+        alignas(memory_alignment<mask>::value) bool mem[size()];
+        x.memstore(mem, flags::vector_aligned);
+        memload(mem, flags::vector_aligned);
     }
     /* reference implementation for explicit mask casts
     template <class U>
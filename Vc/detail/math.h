@@ -0,0 +1,804 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016-2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_MATH_H_
+#define VC_DATAPAR_MATH_H_
+
+#include "synopsis.h"
+#include <cmath>
+#include <limits>
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// double_const / float_const {{{1
+// Construct a floating-point constant from its binary representation (mantissa without the
+// implicit bit and unbiased exponent). This allows exact constants without hex-float literals.
+template <int Sign, unsigned long long Mantissa, int Exponent>
+constexpr double double_const()
+{
+    double r = static_cast<double>((Mantissa & 0x000fffffffffffffull) |
+                                   0x0010000000000000ull) /
+               0x0010000000000000ull;
+    for (int i = 0; i < Exponent; ++i) {
+        r *= 2.;
+    }
+    for (int i = 0; i > Exponent; --i) {
+        r *= .5;
+    }
+    return Sign * r;
+}
+
+template <int Sign, unsigned int Mantissa, int Exponent> constexpr float float_const()
+{
+    return static_cast<float>(double_const<Sign, static_cast<unsigned long long>(Mantissa)
+                                                     << 29,
+                                           Exponent>());
+}
+
+// helpers for the math kernels {{{1
+template <class T, class A> Vc_INTRINSIC mask<T, A> is_nan(const datapar<T, A> &x)
+{
+    return x != x;
+}
+
+template <class T, class A> Vc_INTRINSIC mask<T, A> is_finite(const datapar<T, A> &x)
+{
+    return abs(x) <= std::numeric_limits<T>::max();
+}
+
+// true for negative values including -0
+template <class T, class A> Vc_INTRINSIC mask<T, A> is_negative(const datapar<T, A> &x)
+{
+    return x < 0 || (x == 0 && T(1) / x < 0);
+}
+
+template <class T, class A>
+Vc_INTRINSIC datapar<T, A> copy_sign(const datapar<T, A> &x, const datapar<T, A> &sign)
+{
+    datapar<T, A> r = abs(x);
+    where(is_negative(sign), r) = -r;
+    return r;
+}
+
+// Returns floor(x) for x >= 0 without conversion to an integer vector. Adding and
+// subtracting 2^digits rounds to nearest; values larger than that are integral already.
+template <class T, class A> Vc_INTRINSIC datapar<T, A> floor_positive(const datapar<T, A> &x)
+{
+    const T shifter = T(1) / std::numeric_limits<T>::epsilon();
+    datapar<T, A> r = x;
+    where(x < shifter, r) = (x + shifter) - shifter;
+    where(r > x, r) -= 1;
+    return r;
+}
+
+// Returns floor(x) for any sign, built on floor_positive.
+template <class T, class A> Vc_INTRINSIC datapar<T, A> floor(const datapar<T, A> &x)
+{
+    const datapar<T, A> a = abs(x);
+    datapar<T, A> r = floor_positive(a);
+    where(x < 0 && r != a, r) += 1;
+    where(x < 0, r) = -r;
+    return r;
+}
+
+// Returns v * 2ⁿ for integral n. The factor is applied in two steps so that n may exceed the
+// range of normal exponents, which is needed for results close to overflow or in the
+// denormal range.
+template <class T, class A>
+Vc_INTRINSIC datapar<T, A> scale(const datapar<T, A> &v, const datapar<T, A> &n)
+{
+    using Impl = get_impl_t<datapar<T, A>>;
+    const datapar<T, A> n1 = floor(n * T(.5));
+    return v * Impl::exp2_integral(n1) * Impl::exp2_integral(n - n1);
+}
+
+// trig_common {{{1
+// Algorithm for sine and cosine:
+// The result is calculated with the sine or cosine series depending on the π/4 section the
+// input is in. The precision of x - n * π/4 is extended by calculating
+// ((x - n * p1) - n * p2) - n * p3 (with p1 + p2 + p3 = π/4).
+// The quadrant is tracked in floating-point, since the section index is integral and exactly
+// representable, and the sign is fixed up at the end.
+template <class T, class C> struct trig_common {
+    template <class A> using V = datapar<T, A>;
+    template <class A> using M = mask<T, A>;
+
+    // fold_input {{{2
+    template <class A> static Vc_ALWAYS_INLINE V<A> fold_input(V<A> x, V<A> &quadrant)
+    {
+        x = abs(x);
+        V<A> y = floor_positive(C::scale_to_octant(x));
+        // odd octants are mapped to the next even one, so that |x - y * π/4| <= π/4
+        where(floor_positive(y * T(.5)) * 2 != y, y) += 1;
+        quadrant = y - floor_positive(y * T(.125)) * 8;
+        return ((x - y * C::pi_4_hi()) - y * C::pi_4_rem1()) - y * C::pi_4_rem2();
+    }
+
+    // sin {{{2
+    template <class A> static V<A> sin(const V<A> &x)
+    {
+        V<A> quadrant;
+        const V<A> z = fold_input(x, quadrant);
+        const M<A> sign = (x < 0) ^ (quadrant > 3);
+        where(quadrant > 3, quadrant) -= 4;
+
+        V<A> y = C::sin_series(z);
+        where(quadrant == 2, y) = C::cos_series(z);
+        where(sign, y) = -y;
+        return y;
+    }
+
+    // cos {{{2
+    template <class A> static V<A> cos(const V<A> &x)
+    {
+        V<A> quadrant;
+        const V<A> z = fold_input(x, quadrant);
+        M<A> sign = quadrant > 3;
+        where(quadrant > 3, quadrant) -= 4;
+        sign = sign ^ (quadrant > 1);
+
+        V<A> y = C::cos_series(z);
+        where(quadrant == 2, y) = C::sin_series(z);
+        where(sign, y) = -y;
+        return y;
+    }
+
+    // sincos {{{2
+    template <class A> static void sincos(const V<A> &x, V<A> *sin, V<A> *cos)
+    {
+        V<A> quadrant;
+        const V<A> z = fold_input(x, quadrant);
+        const M<A> sign = quadrant > 3;
+        where(quadrant > 3, quadrant) -= 4;
+
+        const V<A> cos_s = C::cos_series(z);
+        const V<A> sin_s = C::sin_series(z);
+        const M<A> swap = quadrant == 2;
+
+        V<A> c = cos_s;
+        where(swap, c) = sin_s;
+        where(sign ^ (quadrant > 1), c) = -c;
+        *cos = c;
+
+        V<A> s = sin_s;
+        where(swap, s) = cos_s;
+        where(sign ^ (x < 0), s) = -s;
+        *sin = s;
+    }
+
+    // atan2 {{{2
+    template <class A> static V<A> atan2(const V<A> &y, const V<A> &x)
+    {
+        const M<A> xZero = x == 0;
+        const M<A> yZero = y == 0;
+        const M<A> xMinusZero = xZero && is_negative(x);
+        const M<A> yNeg = y < 0;
+        const M<A> xInf = !is_finite(x);
+        const M<A> yInf = !is_finite(y);
+
+        V<A> a = copy_sign(V<A>(C::pi()), y);
+        where(x >= 0, a) = 0;
+
+        // setting x to any finite value will have atan(y/x) return sign(y/x)*pi/2, just in
+        // case x is inf
+        V<A> x_ = x;
+        where(yInf, x_) = copy_sign(V<A>(1), x);
+
+        a += C::atan(y / x_);
+
+        // if x is +0 and y is +/-0 the result is +0
+        where(xZero && yZero, a) = 0;
+
+        // for x = -0 we add/subtract pi to get the correct result
+        where(xMinusZero, a) += copy_sign(V<A>(C::pi()), y);
+
+        // atan2(-Y, +/-0) = -pi/2
+        where(xZero && yNeg, a) = -C::pi_2();
+
+        // if both inputs are inf the output is +/- (3)pi/4
+        V<A> pi_4 = C::pi_4();
+        where(!(is_negative(x) ^ is_negative(y)), pi_4) = -pi_4;
+        where(xInf && yInf, a) += pi_4;
+
+        // correct the sign of y if the result is 0
+        where(a == 0, a) = copy_sign(a, y);
+
+        // any NaN input will lead to NaN output
+        where(is_nan(y) || is_nan(x), a) = std::numeric_limits<T>::quiet_NaN();
+
+        return a;
+    }
+    //}}}2
+};
+
+// trig<T> {{{1
+// The generic case (long double) has no vectorized kernels and falls back to the standard
+// library element by element.
+template <class T> struct trig {
+    template <class A> using V = datapar<T, A>;
+
+    template <class A> static V<A> sin(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::sin(x[i]); });
+    }
+    template <class A> static V<A> cos(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::cos(x[i]); });
+    }
+    template <class A> static void sincos(const V<A> &x, V<A> *sin, V<A> *cos)
+    {
+        *sin = V<A>([&](auto i) { return std::sin(x[i]); });
+        *cos = V<A>([&](auto i) { return std::cos(x[i]); });
+    }
+    template <class A> static V<A> asin(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::asin(x[i]); });
+    }
+    template <class A> static V<A> atan(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::atan(x[i]); });
+    }
+    template <class A> static V<A> atan2(const V<A> &y, const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::atan2(y[i], x[i]); });
+    }
+};
+
+// trig<float> {{{1
+template <> struct trig<float> : public trig_common<float, trig<float>> {
+    template <class A> using V = datapar<float, A>;
+    template <class A> using M = mask<float, A>;
+
+    // constants {{{2
+    static constexpr float pi_4()      { return float_const< 1, 0x490FDB,  -1>(); }
+    static constexpr float pi_4_hi()   { return float_const< 1, 0x491000,  -1>(); }
+    static constexpr float pi_4_rem1() { return float_const<-1, 0x157000, -19>(); }
+    static constexpr float pi_4_rem2() { return float_const<-1, 0x6F4B9F, -32>(); }
+    static constexpr float pi_2()      { return float_const< 1, 0x490FDB,   0>(); }
+    static constexpr float pi()        { return float_const< 1, 0x490FDB,   1>(); }
+
+    template <class A> static Vc_ALWAYS_INLINE V<A> scale_to_octant(const V<A> &x)
+    {
+        return x * float_const<1, 0x22F983, 0>();  // 4/π
+    }
+
+    // cos_series / sin_series {{{2
+    template <class A> static Vc_ALWAYS_INLINE V<A> cos_series(const V<A> &x)
+    {
+        const V<A> x2 = x * x;
+        return ((2.443315711809948e-5f  * x2 -   //  1/8!
+                 1.388731625493765e-3f) * x2 +   // -1/6!
+                 4.166664568298827e-2f) * (x2 * x2) -  // 1/4!
+               .5f * x2 + 1;
+    }
+    template <class A> static Vc_ALWAYS_INLINE V<A> sin_series(const V<A> &x)
+    {
+        const V<A> x2 = x * x;
+        return ((-1.9515295891e-4f  * x2 +   // -1/7!
+                  8.3321608736e-3f) * x2 -   //  1/5!
+                  1.6666654611e-1f) * (x2 * x) +  // -1/3!
+               x;
+    }
+
+    // asin {{{2
+    template <class A> static V<A> asin(const V<A> &x_)
+    {
+        const M<A> negative = x_ < 0;
+
+        const V<A> a = abs(x_);
+        const M<A> outOfRange = a > 1;
+        const M<A> small = a < 1.e-4f;
+        const M<A> gt_0_5 = a > .5f;
+        V<A> x = a;
+        V<A> z = a * a;
+        where(gt_0_5, z) = (1 - a) * .5f;
+        where(gt_0_5, x) = sqrt(z);
+        z = ((((4.2163199048e-2f  * z +
+                2.4181311049e-2f) * z +
+                4.5470025998e-2f) * z +
+                7.4953002686e-2f) * z +
+                1.6666752422e-1f) * z * x +
+            x;
+        where(gt_0_5, z) = pi_2() - (z + z);
+        where(small, z) = a;
+        where(negative, z) = -z;
+        where(outOfRange, z) = std::numeric_limits<float>::quiet_NaN();
+
+        return z;
+    }
+
+    // atan {{{2
+    template <class A> static V<A> atan(const V<A> &x_)
+    {
+        V<A> x = abs(x_);
+        const M<A> gt_tan_3pi_8 = x > 2.414213562373095f;
+        const M<A> gt_tan_pi_8 = x > 0.414213562373095f && !gt_tan_3pi_8;
+        V<A> y = 0;
+        where(gt_tan_3pi_8, y) = pi_2();
+        where(gt_tan_pi_8, y) = pi_4();
+        where(gt_tan_3pi_8, x) = -1 / x;
+        where(gt_tan_pi_8, x) = (x - 1) / (x + 1);
+        const V<A> x2 = x * x;
+        y += (((8.05374449538e-2f  * x2 -
+                1.38776856032e-1f) * x2 +
+                1.99777106478e-1f) * x2 -
+                3.33329491539e-1f) * x2 * x +
+             x;
+        where(x_ < 0, y) = -y;
+        where(is_nan(x_), y) = std::numeric_limits<float>::quiet_NaN();
+        return y;
+    }
+    //}}}2
+};
+
+// trig<double> {{{1
+template <> struct trig<double> : public trig_common<double, trig<double>> {
+    template <class A> using V = datapar<double, A>;
+    template <class A> using M = mask<double, A>;
+
+    // constants {{{2
+    static constexpr double pi_4()      { return double_const<1, 0x921fb54442d18ull,  -1>(); }
+    static constexpr double pi_4_hi()   { return double_const<1, 0x921fb40000000ull,  -1>(); }
+    static constexpr double pi_4_rem1() { return double_const<1, 0x4442d00000000ull, -25>(); }
+    static constexpr double pi_4_rem2() { return double_const<1, 0x8469898cc5170ull, -49>(); }
+    static constexpr double pi_2()      { return double_const<1, 0x921fb54442d18ull,   0>(); }
+    static constexpr double pi()        { return double_const<1, 0x921fb54442d18ull,   1>(); }
+    static constexpr double pi_2_rem()  { return double_const<1, 0x1A62633145C07ull, -54>(); }
+
+    template <class A> static Vc_ALWAYS_INLINE V<A> scale_to_octant(const V<A> &x)
+    {
+        return x / pi_4();  // * 4/π would work, but is >twice as imprecise
+    }
+
+    // cos_series / sin_series {{{2
+    template <class A> static Vc_ALWAYS_INLINE V<A> cos_series(const V<A> &x)
+    {
+        const V<A> x2 = x * x;
+        return (((((double_const<-1, 0x8fa49a0861a9bull, -37>()  * x2 +   // -1/14!
+                    double_const< 1, 0x1ee9d7b4e3f05ull, -29>()) * x2 +   //  1/12!
+                    double_const<-1, 0x27e4f7eac4bc6ull, -22>()) * x2 +   // -1/10!
+                    double_const< 1, 0xa01a019c844f5ull, -16>()) * x2 +   //  1/8!
+                    double_const<-1, 0x6c16c16c14f91ull, -10>()) * x2 +   // -1/6!
+                    double_const< 1, 0x555555555554bull,  -5>()) * (x2 * x2) -  // 1/4!
+               .5 * x2 + 1;
+    }
+    template <class A> static Vc_ALWAYS_INLINE V<A> sin_series(const V<A> &x)
+    {
+        const V<A> x2 = x * x;
+        return (((((double_const< 1, 0x5d8fd1fd19ccdull, -33>()  * x2 +   //  1/13!
+                    double_const<-1, 0xae5e5a9291f5dull, -26>()) * x2 +   // -1/11!
+                    double_const< 1, 0x71de3567d48a1ull, -19>()) * x2 +   //  1/9!
+                    double_const<-1, 0xa01a019bfdf03ull, -13>()) * x2 +   // -1/7!
+                    double_const< 1, 0x111111110f7d0ull,  -7>()) * x2 +   //  1/5!
+                    double_const<-1, 0x5555555555548ull,  -3>()) * (x2 * x) +  // -1/3!
+               x;
+    }
+
+    // asin {{{2
+    template <class A> static V<A> asin(const V<A> &x)
+    {
+        const M<A> negative = x < 0;
+
+        const V<A> a = abs(x);
+        const M<A> outOfRange = a > 1;
+        const M<A> small = a < 1.e-8;
+        const M<A> large = a > .625;
+
+        const V<A> zz = 1 - a;
+        const V<A> r = (((double_const< 1, 0x84fc3988e9f08ull, -9>()  * zz +
+                          double_const<-1, 0x2079259f9290full, -1>()) * zz +
+                          double_const< 1, 0xbdff5baf33e6aull,  2>()) * zz +
+                          double_const<-1, 0x991aaac01ab68ull,  4>()) * zz +
+                          double_const< 1, 0xc896240f3081dull,  4>();
+        const V<A> s = (((zz +
+                          double_const<-1, 0x5f2a2b6bf5d8cull, 4>()) * zz +
+                          double_const< 1, 0x26219af6a7f42ull, 7>()) * zz +
+                          double_const<-1, 0x7fe08959063eeull, 8>()) * zz +
+                          double_const< 1, 0x56709b0b644beull, 8>();
+        const V<A> sqrtzz = sqrt(zz + zz);
+        V<A> z = pi_4() - sqrtzz;
+        z -= sqrtzz * (zz * r / s) - pi_2_rem();
+        z += pi_4();
+
+        const V<A> a2 = a * a;
+        const V<A> p = ((((double_const< 1, 0x16b9b0bd48ad3ull, -8>()  * a2 +
+                            double_const<-1, 0x34341333e5c16ull, -1>()) * a2 +
+                            double_const< 1, 0x5c74b178a2dd9ull,  2>()) * a2 +
+                            double_const<-1, 0x04331de27907bull,  4>()) * a2 +
+                            double_const< 1, 0x39007da779259ull,  4>()) * a2 +
+                            double_const<-1, 0x0656c06ceafd5ull,  3>();
+        const V<A> q = ((((a2 +
+                            double_const<-1, 0xd7b590b5e0eabull, 3>()) * a2 +
+                            double_const< 1, 0x19fc025fe9054ull, 6>()) * a2 +
+                            double_const<-1, 0x265bb6d3576d7ull, 7>()) * a2 +
+                            double_const< 1, 0x1705684ffbf9dull, 7>()) * a2 +
+                            double_const<-1, 0x898220a3607acull, 5>();
+        where(!large, z) = a * (a2 * p / q) + a;
+
+        where(negative, z) = -z;
+        where(small, z) = x;
+        where(outOfRange, z) = std::numeric_limits<double>::quiet_NaN();
+
+        return z;
+    }
+
+    // atan {{{2
+    template <class A> static V<A> atan(const V<A> &x_)
+    {
+        const M<A> sign = x_ < 0;
+        V<A> x = abs(x_);
+        const M<A> finite = is_finite(x_);
+        V<A> ret = pi_2();
+        V<A> y = 0;
+        const M<A> large = x > double_const<1, 0x3504f333f9de6ull, 1>();  // tan(3/8 π)
+        const M<A> gt_06 = x > .66;
+        V<A> tmp = (x - 1) / (x + 1);
+        where(large, tmp) = -1 / x;
+        where(gt_06, x) = tmp;
+        where(gt_06, y) = pi_4();
+        where(large, y) = pi_2();
+        V<A> z = x * x;
+        const V<A> p = (((double_const<-1, 0xc007fa1f72594ull, -1>()  * z +
+                           double_const<-1, 0x028545b6b807aull,  4>()) * z +
+                           double_const<-1, 0x2c08c36880273ull,  6>()) * z +
+                           double_const<-1, 0xeb8bf2d05ba25ull,  6>()) * z +
+                           double_const<-1, 0x03669fd28ec8eull,  6>();
+        const V<A> q = ((((z +
+                           double_const<1, 0x8dbc45b14603cull, 4>()) * z +
+                           double_const<1, 0x4a0dd43b8fa25ull, 7>()) * z +
+                           double_const<1, 0xb0e18d2e2be3bull, 8>()) * z +
+                           double_const<1, 0xe563f13b049eaull, 8>()) * z +
+                           double_const<1, 0x8519efbbd62ecull, 7>();
+        z = z * p / q;
+        z = x * z + x;
+        V<A> morebits = pi_2_rem();
+        where(!large, morebits) *= .5;
+        where(gt_06, z) += morebits;
+        where(finite, ret) = y + z;
+        where(sign, ret) = -ret;
+        where(is_nan(x_), ret) = std::numeric_limits<double>::quiet_NaN();
+        return ret;
+    }
+    //}}}2
+};
+// exp_log_common {{{1
+enum LogarithmBase { BaseE, Base10, Base2 };
+
+// Algorithm for exp:
+// x = n * ln(2) + y with integral n and |y| <= ln(2)/2, thus exp(x) = 2ⁿ * exp(y). The
+// product n * ln(2) is subtracted in two parts, where the first part is exact.
+//
+// Algorithm for log:
+// x = 2^e * f with f ∈ [√½, √2[, thus log(x) = e * ln(2) + log(f). log(1 + (f - 1)) is
+// calculated with a polynomial (float) or rational (double) approximation. Denormal inputs are
+// scaled into the normal range first, and the exponent is corrected accordingly.
+template <class T, class C> struct exp_log_common {
+    template <class A> using V = datapar<T, A>;
+    template <class A> using M = mask<T, A>;
+    using limits = std::numeric_limits<T>;
+
+    // exp {{{2
+    template <class A> static V<A> exp(const V<A> &x)
+    {
+        V<A> xc = x;
+        where(!(x < C::max_log()), xc) = C::max_log();  // also catches NaN
+        where(x < C::min_log(), xc) = C::min_log();
+        const V<A> n = floor(xc * C::log2_e() + T(.5));
+        const V<A> y = (xc - n * C::ln2_large()) - n * C::ln2_small();
+        V<A> r = scale(C::exp_series(y), n);
+        where(x > C::max_log(), r) = limits::infinity();
+        where(x < C::min_log(), r) = 0;
+        where(is_nan(x), r) = x;
+        return r;
+    }
+
+    // exp2 {{{2
+    template <class A> static V<A> exp2(const V<A> &x)
+    {
+        const T max_exp = limits::max_exponent;
+        const T min_exp = limits::min_exponent - limits::digits - 1;
+        V<A> xc = x;
+        where(!(x < max_exp), xc) = max_exp;  // also catches NaN
+        where(x < min_exp, xc) = min_exp;
+        const V<A> n = floor(xc + T(.5));
+        V<A> r = scale(C::exp_series((xc - n) * C::ln2()), n);
+        where(x >= max_exp, r) = limits::infinity();
+        where(x < min_exp, r) = 0;
+        where(is_nan(x), r) = x;
+        return r;
+    }
+
+    // log {{{2
+    template <LogarithmBase Base, class A> static V<A> log(V<A> x)
+    {
+        using Impl = get_impl_t<V<A>>;
+        const M<A> invalid = x < 0 || is_nan(x);
+        const M<A> zero = x == 0;
+        const M<A> infinite = x == limits::infinity();
+        const M<A> denormal = x < limits::min() && x > 0;
+
+        where(denormal, x) *= T(2) / limits::epsilon();
+        V<A> e = Impl::exponent(x);
+        where(denormal, e) -= T(limits::digits);
+        x = Impl::fraction(x);
+
+        const M<A> small_x = x < C::sqrt_1_2();
+        where(small_x, x) += x;
+        x -= 1;
+        where(!small_x, e) += 1;
+
+        const V<A> x2 = x * x;
+        V<A> y = C::log_series(x, x2);
+        if (Base == Base2) {
+            const V<A> x_ = x;
+            x *= C::log2_e();
+            y *= C::log2_e();
+            y -= x_ * x * T(.5);
+            x += y;
+            x += e;
+        } else {
+            y += e * C::ln2_small();
+            y -= x2 * T(.5);
+            x += y;
+            x += e * C::ln2_large();
+            if (Base == Base10) {
+                x *= C::log10_e();
+            }
+        }
+
+        where(zero, x) = -limits::infinity();
+        where(infinite, x) = limits::infinity();
+        where(invalid, x) = limits::quiet_NaN();
+        return x;
+    }
+
+    // log1p {{{2
+    // Kahan's formula: log(u) * x / (u - 1) with u = 1 + x corrects the rounding error of u.
+    template <class A> static V<A> log1p(const V<A> &x)
+    {
+        const V<A> u = 1 + x;
+        V<A> r = x;
+        const M<A> inexact = u != 1;
+        where(inexact, r) = log<BaseE>(u) * (x / (u - 1));
+        where(x == limits::infinity(), r) = x;
+        return r;
+    }
+    //}}}2
+};
+
+// exp_log<T> {{{1
+// The generic case (long double) has no vectorized kernels and falls back to the standard
+// library element by element.
+template <class T> struct exp_log {
+    template <class A> using V = datapar<T, A>;
+
+    template <class A> static V<A> exp(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::exp(x[i]); });
+    }
+    template <class A> static V<A> exp2(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::exp2(x[i]); });
+    }
+    template <LogarithmBase Base, class A> static V<A> log(const V<A> &x)
+    {
+        return V<A>([&](auto i) {
+            return Base == Base2 ? std::log2(x[i])
+                                 : Base == Base10 ? std::log10(x[i]) : std::log(x[i]);
+        });
+    }
+    template <class A> static V<A> log1p(const V<A> &x)
+    {
+        return V<A>([&](auto i) { return std::log1p(x[i]); });
+    }
+};
+
+// exp_log<float> {{{1
+template <> struct exp_log<float> : public exp_log_common<float, exp_log<float>> {
+    template <class A> using V = datapar<float, A>;
+
+    // constants {{{2
+    static constexpr float ln2()        { return float_const< 1, 0x317218,  -1>(); }
+    static constexpr float ln2_large()  { return float_const< 1, 0x318000,  -1>(); }
+    static constexpr float ln2_small()  { return float_const<-1, 0x5E8083, -13>(); }
+    static constexpr float log2_e()     { return float_const< 1, 0x38AA3B,   0>(); }
+    static constexpr float log10_e()    { return float_const< 1, 0x5E5BD9,  -2>(); }
+    static constexpr float sqrt_1_2()   { return float_const< 1, 0x3504F3,  -1>(); }
+    static constexpr float max_log()    { return 88.72283905206835f; }
+    static constexpr float min_log()    { return -103.97207708399179641f; }
+
+    // exp_series {{{2
+    // exp(x) for |x| <= ln(2)/2
+    template <class A> static Vc_ALWAYS_INLINE V<A> exp_series(const V<A> &x)
+    {
+        return (((((1.9875691500E-4f * x + 1.3981999507E-3f) * x + 8.3334519073E-3f) * x +
+                  4.1665795894E-2f) * x + 1.6666665459E-1f) * x + 5.0000001201E-1f) *
+                   (x * x) + x + 1;
+    }
+
+    // log_series {{{2
+    // log(1 + x) - x + x²/2 for x ∈ [√½ - 1, √2 - 1[
+    template <class A>
+    static Vc_ALWAYS_INLINE V<A> log_series(const V<A> &x, const V<A> &x2)
+    {
+        V<A> y = 7.0376836292E-2f;
+        y = y * x - 1.1514610310E-1f;
+        y = y * x + 1.1676998740E-1f;
+        y = y * x - 1.2420140846E-1f;
+        y = y * x + 1.4249322787E-1f;
+        y = y * x - 1.6668057665E-1f;
+        y = y * x + 2.0000714765E-1f;
+        y = y * x - 2.4999993993E-1f;
+        y = y * x + 3.3333331174E-1f;
+        return y * (x * x2);
+    }
+    //}}}2
+};
+
+// exp_log<double> {{{1
+template <> struct exp_log<double> : public exp_log_common<double, exp_log<double>> {
+    template <class A> using V = datapar<double, A>;
+
+    // constants {{{2
+    static constexpr double ln2()       { return double_const< 1, 0x62E42FEFA39EFull,  -1>(); }
+    static constexpr double ln2_large() { return double_const< 1, 0x62E4000000000ull,  -1>(); }
+    static constexpr double ln2_small() { return double_const< 1, 0x7F7D1CF79ABCAull, -20>(); }
+    static constexpr double log2_e()    { return double_const< 1, 0x71547652B82FEull,   0>(); }
+    static constexpr double log10_e()   { return double_const< 1, 0xBCB7B1526E50Eull,  -2>(); }
+    static constexpr double sqrt_1_2()  { return double_const< 1, 0x6A09E667F3BCDull,  -1>(); }
+    static constexpr double max_log()   { return 7.09782712893383996843E2; }
+    static constexpr double min_log()   { return -7.451332191019412076235E2; }
+
+    // exp_series {{{2
+    // exp(x) for |x| <= ln(2)/2, via the Padé form 1 + 2x P(x²) / (Q(x²) - x P(x²))
+    template <class A> static Vc_ALWAYS_INLINE V<A> exp_series(const V<A> &x)
+    {
+        const V<A> xx = x * x;
+        const V<A> px =
+            x * ((1.26177193074810590878E-4 * xx + 3.02994407707441961300E-2) * xx +
+                 9.99999999999999999910E-1);
+        const V<A> q = ((3.00198505138664455042E-6 * xx + 2.52448340349684104192E-3) * xx +
+                        2.27265548208155028766E-1) * xx + 2.00000000000000000009E0;
+        return 1 + 2 * (px / (q - px));
+    }
+
+    // log_series {{{2
+    // log(1 + x) - x + x²/2 for x ∈ [√½ - 1, √2 - 1[
+    template <class A>
+    static Vc_ALWAYS_INLINE V<A> log_series(const V<A> &x, const V<A> &x2)
+    {
+        V<A> p = 1.01875663804580931796E-4;
+        p = p * x + 4.97494994976747001425E-1;
+        p = p * x + 4.70579119878881725854E0;
+        p = p * x + 1.44989225341610930846E1;
+        p = p * x + 1.79368678507819816313E1;
+        p = p * x + 7.70838733755885391666E0;
+        V<A> q = x + 1.12873587189167450590E1;
+        q = q * x + 4.52279145837532221105E1;
+        q = q * x + 8.29875266912776603211E1;
+        q = q * x + 7.11544750618563894466E1;
+        q = q * x + 2.31251620126765340583E1;
+        return x * x2 * p / q;
+    }
+    //}}}2
+};
+//}}}1
+}  // namespace detail
+
+// trigonometric functions {{{1
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> sin(
+    const datapar<T, Abi> &x)
+{
+    return detail::trig<T>::sin(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> cos(
+    const datapar<T, Abi> &x)
+{
+    return detail::trig<T>::cos(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, void> sincos(const datapar<T, Abi> &x,
+                                                                 datapar<T, Abi> *sin,
+                                                                 datapar<T, Abi> *cos)
+{
+    detail::trig<T>::sincos(x, sin, cos);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> asin(
+    const datapar<T, Abi> &x)
+{
+    return detail::trig<T>::asin(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> atan(
+    const datapar<T, Abi> &x)
+{
+    return detail::trig<T>::atan(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> atan2(
+    const datapar<T, Abi> &y, const datapar<T, Abi> &x)
+{
+    return detail::trig<T>::atan2(y, x);
+}
+
+// exponential and logarithmic functions {{{1
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> exp(
+    const datapar<T, Abi> &x)
+{
+    return detail::exp_log<T>::exp(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> exp2(
+    const datapar<T, Abi> &x)
+{
+    return detail::exp_log<T>::exp2(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> log(
+    const datapar<T, Abi> &x)
+{
+    return detail::exp_log<T>::template log<detail::BaseE>(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> log2(
+    const datapar<T, Abi> &x)
+{
+    return detail::exp_log<T>::template log<detail::Base2>(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> log10(
+    const datapar<T, Abi> &x)
+{
+    return detail::exp_log<T>::template log<detail::Base10>(x);
+}
+
+template <class T, class Abi>
+enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> log1p(
+    const datapar<T, Abi> &x)
+{
+    return detail::exp_log<T>::log1p(x);
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_MATH_H_
+
+// vim: foldmethod=marker
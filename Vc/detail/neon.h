@@ -220,6 +220,23 @@ struct neon_datapar_impl : public generic_datapar_impl<neon_datapar_impl> {
         });
     }
   
+    // add_sat, sub_sat & avg {{{2
+    template <class T>
+    static Vc_INTRINSIC datapar<T> add_sat(const datapar<T> &x, const datapar<T> &y) noexcept
+    {
+        return make_datapar<T, abi>(aarch::add_sat(x.d, y.d));
+    }
+    template <class T>
+    static Vc_INTRINSIC datapar<T> sub_sat(const datapar<T> &x, const datapar<T> &y) noexcept
+    {
+        return make_datapar<T, abi>(aarch::sub_sat(x.d, y.d));
+    }
+    template <class T>
+    static Vc_INTRINSIC datapar<T> avg(const datapar<T> &x, const datapar<T> &y) noexcept
+    {
+        return make_datapar<T, abi>(aarch::avg(x.d, y.d));
+    }
+
      // negation {{{2
     template <class T> static Vc_INTRINSIC mask<T> negate(datapar<T> x) noexcept
     {
@@ -0,0 +1,540 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_PERMUTE_H_
+#define VC_DATAPAR_PERMUTE_H_
+
+#include "synopsis.h"
+#include <cstring>
+#ifdef Vc_HAVE_SSE2
+#include "x86/intrinsics.h"
+#endif
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// permutation {{{1
+// Carries the constant indexes of permute<I...>() and derives the immediates and
+// classifications the x86 implementations need from them.
+template <int... I> struct permutation {
+    static constexpr int size() { return sizeof...(I); }
+    static constexpr int idx[sizeof...(I)] = {I...};
+
+    static constexpr bool in_range()
+    {
+        for (int k = 0; k < size(); ++k) {
+            if (idx[k] < 0 || idx[k] >= size()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // true if no entry moves out of its group of L consecutive entries
+    static constexpr bool lane_local(int L)
+    {
+        for (int k = 0; k < size(); ++k) {
+            if (idx[k] / L != k / L) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // true if, additionally, all groups of L entries use the same pattern
+    static constexpr bool lane_uniform(int L)
+    {
+        for (int k = 0; k < size(); ++k) {
+            if (idx[k] / L != k / L || idx[k] % L != idx[k % L] % L) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // immediate with B bits per entry for the M entries starting at First
+    static constexpr int imm(int B, int M, int First = 0)
+    {
+        int r = 0;
+        for (int k = 0; k < M; ++k) {
+            r |= (idx[First + k] & ((1 << B) - 1)) << (k * B);
+        }
+        return r;
+    }
+
+    // pshufd immediate that moves the two 64-bit entries as pairs of 32-bit entries
+    static constexpr int imm64_as_32()
+    {
+        int r = 0;
+        for (int k = 0; k < 2; ++k) {
+            const int i = 2 * (idx[k] & 1);
+            r |= (i | (i + 1) << 2) << (4 * k);
+        }
+        return r;
+    }
+
+    // bit k is set if entry k is taken from the other 128-bit lane (L entries per lane)
+    static constexpr int cross_lane_bits(int L)
+    {
+        int r = 0;
+        for (int k = 0; k < size(); ++k) {
+            r |= (idx[k] / L != k / L) << k;
+        }
+        return r;
+    }
+
+    // pshufb control byte j for E bytes per entry, relative to its 16-byte lane
+    static constexpr char byte(int j, int E) { return (idx[j / E] * E + j % E) % 16; }
+
+    // pshufb blend byte j: -1 if byte j is taken from the other 16-byte lane
+    static constexpr char cross_lane_byte(int j, int E)
+    {
+        return idx[j / E] * E / 16 != j / 16 ? -1 : 0;
+    }
+};
+template <int... I> constexpr int permutation<I...>::idx[sizeof...(I)];
+
+// index_vector {{{1
+template <class T, int... I> struct index_vector {
+    alignas(64) static constexpr T value[sizeof...(I)] = {T(I)...};
+};
+template <class T, int... I> alignas(64) constexpr T index_vector<T, I...>::value[sizeof...(I)];
+
+#ifdef Vc_HAVE_SSE2
+namespace x86
+{
+// permute_via_memory {{{1
+// Fallback for patterns the target has no suitable shuffle instruction for.
+template <class V, int... I> Vc_INTRINSIC V permute_via_memory(permutation<I...>, V v)
+{
+    constexpr size_t E = sizeof(V) / sizeof...(I);
+    using T = std::conditional_t<
+        E == 1, uchar, std::conditional_t<E == 2, ushort, std::conditional_t<E == 4, uint, ullong>>>;
+    T in[sizeof...(I)];
+    std::memcpy(in, &v, sizeof(V));
+    const T out[sizeof...(I)] = {in[I]...};
+    std::memcpy(&v, out, sizeof(V));
+    return v;
+}
+
+// permute(__m128) {{{1
+template <int... I> Vc_INTRINSIC __m128 permute(permutation<I...>, __m128 v)
+{
+    using P = permutation<I...>;
+    static_assert(sizeof...(I) == 4, "");
+    return _mm_shuffle_ps(v, v, P::imm(2, 4));
+}
+
+template <int... I> Vc_INTRINSIC __m128d permute(permutation<I...>, __m128d v)
+{
+    using P = permutation<I...>;
+    static_assert(sizeof...(I) == 2, "");
+    return _mm_shuffle_pd(v, v, P::imm(1, 2));
+}
+
+template <int... I>
+Vc_INTRINSIC __m128i permute_epi(size_constant<8>, permutation<I...>, __m128i v)
+{
+    return _mm_shuffle_epi32(v, permutation<I...>::imm64_as_32());
+}
+
+template <int... I>
+Vc_INTRINSIC __m128i permute_epi(size_constant<4>, permutation<I...>, __m128i v)
+{
+    return _mm_shuffle_epi32(v, permutation<I...>::imm(2, 4));
+}
+
+template <size_t E, int... I>
+Vc_INTRINSIC __m128i permute_epi(size_constant<E>, permutation<I...>, __m128i v)
+{
+    using P = permutation<I...>;
+#ifdef Vc_HAVE_SSSE3
+    return _mm_shuffle_epi8(
+        v, _mm_setr_epi8(P::byte(0, E), P::byte(1, E), P::byte(2, E), P::byte(3, E),
+                         P::byte(4, E), P::byte(5, E), P::byte(6, E), P::byte(7, E),
+                         P::byte(8, E), P::byte(9, E), P::byte(10, E), P::byte(11, E),
+                         P::byte(12, E), P::byte(13, E), P::byte(14, E), P::byte(15, E)));
+#else   // Vc_HAVE_SSSE3
+    if (E == 2 && P::lane_local(4)) {
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, P::imm(2, 4)), P::imm(2, 4, 4));
+    }
+    return permute_via_memory(P(), v);
+#endif  // Vc_HAVE_SSSE3
+}
+
+template <int... I> Vc_INTRINSIC __m128i permute(permutation<I...> p, __m128i v)
+{
+    return permute_epi(size_tag<16 / sizeof...(I)>, p, v);
+}
+
+#ifdef Vc_HAVE_AVX
+// permute(__m256) {{{1
+template <int... I> Vc_INTRINSIC __m256 permute(permutation<I...>, __m256 v)
+{
+    using P = permutation<I...>;
+    static_assert(sizeof...(I) == 8, "");
+    if (P::lane_uniform(4)) {
+        return _mm256_permute_ps(v, P::imm(2, 4));
+    }
+#ifdef Vc_HAVE_AVX2
+    return _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(I...));
+#else   // Vc_HAVE_AVX2
+    // vpermilps on both the input and its lane-swapped copy, then pick per entry
+    const __m256i ctrl = _mm256_setr_epi32(I...);
+    const __m256 swapped = _mm256_permute2f128_ps(v, v, 0x01);
+    return _mm256_blend_ps(_mm256_permutevar_ps(v, ctrl), _mm256_permutevar_ps(swapped, ctrl),
+                           P::cross_lane_bits(4));
+#endif  // Vc_HAVE_AVX2
+}
+
+template <int... I> Vc_INTRINSIC __m256d permute(permutation<I...>, __m256d v)
+{
+    using P = permutation<I...>;
+    static_assert(sizeof...(I) == 4, "");
+    if (P::lane_local(2)) {
+        return _mm256_permute_pd(v, P::imm(1, 4));
+    }
+#ifdef Vc_HAVE_AVX2
+    return _mm256_permute4x64_pd(v, P::imm(2, 4));
+#else   // Vc_HAVE_AVX2
+    const __m256d swapped = _mm256_permute2f128_pd(v, v, 0x01);
+    return _mm256_blend_pd(_mm256_permute_pd(v, P::imm(1, 4)),
+                           _mm256_permute_pd(swapped, P::imm(1, 4)), P::cross_lane_bits(2));
+#endif  // Vc_HAVE_AVX2
+}
+
+template <int... I>
+Vc_INTRINSIC __m256i permute_epi(size_constant<8>, permutation<I...> p, __m256i v)
+{
+    return intrin_cast<__m256i>(permute(p, intrin_cast<__m256d>(v)));
+}
+
+template <int... I>
+Vc_INTRINSIC __m256i permute_epi(size_constant<4>, permutation<I...> p, __m256i v)
+{
+    return intrin_cast<__m256i>(permute(p, intrin_cast<__m256>(v)));
+}
+
+template <size_t E, int... I>
+Vc_INTRINSIC __m256i permute_epi(size_constant<E>, permutation<I...>, __m256i v)
+{
+    using P = permutation<I...>;
+#ifdef Vc_HAVE_AVX2
+    // pshufb within the lanes of the input and of its lane-swapped copy, then pick per byte
+    const __m256i ctrl = _mm256_setr_epi8(
+        P::byte(0, E), P::byte(1, E), P::byte(2, E), P::byte(3, E), P::byte(4, E), P::byte(5, E),
+        P::byte(6, E), P::byte(7, E), P::byte(8, E), P::byte(9, E), P::byte(10, E), P::byte(11, E),
+        P::byte(12, E), P::byte(13, E), P::byte(14, E), P::byte(15, E), P::byte(16, E),
+        P::byte(17, E), P::byte(18, E), P::byte(19, E), P::byte(20, E), P::byte(21, E),
+        P::byte(22, E), P::byte(23, E), P::byte(24, E), P::byte(25, E), P::byte(26, E),
+        P::byte(27, E), P::byte(28, E), P::byte(29, E), P::byte(30, E), P::byte(31, E));
+    const __m256i in_lane = _mm256_shuffle_epi8(v, ctrl);
+    if (P::lane_local(16 / E)) {
+        return in_lane;
+    }
+    const __m256i cross = _mm256_setr_epi8(
+        P::cross_lane_byte(0, E), P::cross_lane_byte(1, E), P::cross_lane_byte(2, E),
+        P::cross_lane_byte(3, E), P::cross_lane_byte(4, E), P::cross_lane_byte(5, E),
+        P::cross_lane_byte(6, E), P::cross_lane_byte(7, E), P::cross_lane_byte(8, E),
+        P::cross_lane_byte(9, E), P::cross_lane_byte(10, E), P::cross_lane_byte(11, E),
+        P::cross_lane_byte(12, E), P::cross_lane_byte(13, E), P::cross_lane_byte(14, E),
+        P::cross_lane_byte(15, E), P::cross_lane_byte(16, E), P::cross_lane_byte(17, E),
+        P::cross_lane_byte(18, E), P::cross_lane_byte(19, E), P::cross_lane_byte(20, E),
+        P::cross_lane_byte(21, E), P::cross_lane_byte(22, E), P::cross_lane_byte(23, E),
+        P::cross_lane_byte(24, E), P::cross_lane_byte(25, E), P::cross_lane_byte(26, E),
+        P::cross_lane_byte(27, E), P::cross_lane_byte(28, E), P::cross_lane_byte(29, E),
+        P::cross_lane_byte(30, E), P::cross_lane_byte(31, E));
+    return _mm256_blendv_epi8(
+        in_lane, _mm256_shuffle_epi8(_mm256_permute2x128_si256(v, v, 0x01), ctrl), cross);
+#else   // Vc_HAVE_AVX2
+    return permute_via_memory(P(), v);
+#endif  // Vc_HAVE_AVX2
+}
+
+template <int... I> Vc_INTRINSIC __m256i permute(permutation<I...> p, __m256i v)
+{
+    return permute_epi(size_tag<32 / sizeof...(I)>, p, v);
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+// permute(__m512) {{{1
+template <int... I> Vc_INTRINSIC __m512 permute(permutation<I...>, __m512 v)
+{
+    using P = permutation<I...>;
+    static_assert(sizeof...(I) == 16, "");
+    if (P::lane_uniform(4)) {
+        return _mm512_permute_ps(v, P::imm(2, 4));
+    }
+    return _mm512_permutexvar_ps(_mm512_load_si512(index_vector<int, I...>::value), v);
+}
+
+template <int... I> Vc_INTRINSIC __m512d permute(permutation<I...>, __m512d v)
+{
+    using P = permutation<I...>;
+    static_assert(sizeof...(I) == 8, "");
+    if (P::lane_local(2)) {
+        return _mm512_permute_pd(v, P::imm(1, 8));
+    }
+    return _mm512_permutexvar_pd(_mm512_load_si512(index_vector<llong, I...>::value), v);
+}
+
+template <int... I>
+Vc_INTRINSIC __m512i permute_epi(size_constant<8>, permutation<I...> p, __m512i v)
+{
+    return intrin_cast<__m512i>(permute(p, intrin_cast<__m512d>(v)));
+}
+
+template <int... I>
+Vc_INTRINSIC __m512i permute_epi(size_constant<4>, permutation<I...> p, __m512i v)
+{
+    return intrin_cast<__m512i>(permute(p, intrin_cast<__m512>(v)));
+}
+
+template <int... I>
+Vc_INTRINSIC __m512i permute_epi(size_constant<2>, permutation<I...> p, __m512i v)
+{
+#ifdef Vc_HAVE_AVX512BW
+    return _mm512_permutexvar_epi16(_mm512_load_si512(index_vector<short, I...>::value), v);
+#else   // Vc_HAVE_AVX512BW
+    return permute_via_memory(p, v);
+#endif  // Vc_HAVE_AVX512BW
+}
+
+template <int... I>
+Vc_INTRINSIC __m512i permute_epi(size_constant<1>, permutation<I...> p, __m512i v)
+{
+#ifdef Vc_HAVE_AVX512BW
+    if (permutation<I...>::lane_local(16)) {
+        return _mm512_shuffle_epi8(v,
+                                   _mm512_load_si512(index_vector<schar, (I % 16)...>::value));
+    }
+#endif  // Vc_HAVE_AVX512BW
+    return permute_via_memory(p, v);
+}
+
+template <int... I> Vc_INTRINSIC __m512i permute(permutation<I...> p, __m512i v)
+{
+    return permute_epi(size_tag<64 / sizeof...(I)>, p, v);
+}
+#endif  // Vc_HAVE_AVX512F
+
+// permute_var {{{1
+// Runtime permutation of entries with E bytes each; idx holds E-byte integers.
+#ifdef Vc_HAVE_SSSE3
+Vc_INTRINSIC __m128i permute_var(size_constant<1>, __m128i v, __m128i idx)
+{
+    return _mm_shuffle_epi8(v, idx);
+}
+
+Vc_INTRINSIC __m128i permute_var(size_constant<2>, __m128i v, __m128i idx)
+{
+    // byte indexes 2i and 2i + 1
+    return _mm_shuffle_epi8(v, _mm_add_epi16(_mm_mullo_epi16(idx, _mm_set1_epi16(0x0202)),
+                                             _mm_set1_epi16(0x0100)));
+}
+
+Vc_INTRINSIC __m128i permute_var(size_constant<4>, __m128i v, __m128i idx)
+{
+#ifdef Vc_HAVE_AVX
+    return _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(v), idx));
+#else   // Vc_HAVE_AVX
+    const __m128i bytes = _mm_shuffle_epi8(
+        _mm_slli_epi32(idx, 2), _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+    return _mm_shuffle_epi8(v, _mm_add_epi32(bytes, _mm_set1_epi32(0x03020100)));
+#endif  // Vc_HAVE_AVX
+}
+
+Vc_INTRINSIC __m128i permute_var(size_constant<8>, __m128i v, __m128i idx)
+{
+#ifdef Vc_HAVE_AVX
+    // vpermilpd reads the selector from bit 1
+    return _mm_castpd_si128(_mm_permutevar_pd(_mm_castsi128_pd(v), _mm_slli_epi64(idx, 1)));
+#else   // Vc_HAVE_AVX
+    const __m128i bytes = _mm_shuffle_epi8(
+        _mm_slli_epi64(idx, 3), _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8));
+    return _mm_shuffle_epi8(v, _mm_add_epi64(bytes, _mm_set1_epi64x(0x0706050403020100ll)));
+#endif  // Vc_HAVE_AVX
+}
+#endif  // Vc_HAVE_SSSE3
+
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i permute_var(size_constant<4>, __m256i v, __m256i idx)
+{
+    return _mm256_permutevar8x32_epi32(v, idx);
+}
+
+Vc_INTRINSIC __m256i permute_var(size_constant<8>, __m256i v, __m256i idx)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm256_permutexvar_epi64(idx, v);
+#else   // Vc_HAVE_AVX512VL
+    // 32-bit indexes 2i and 2i + 1
+    const __m256i idx2 = _mm256_slli_epi64(idx, 1);
+    return _mm256_permutevar8x32_epi32(
+        v, _mm256_add_epi64(_mm256_or_si256(idx2, _mm256_slli_epi64(idx2, 32)),
+                            _mm256_set1_epi64x(1ll << 32)));
+#endif  // Vc_HAVE_AVX512VL
+}
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i permute_var(size_constant<2>, __m512i v, __m512i idx)
+{
+    return _mm512_permutexvar_epi16(idx, v);
+}
+#endif  // Vc_HAVE_AVX512BW
+
+Vc_INTRINSIC __m512i permute_var(size_constant<4>, __m512i v, __m512i idx)
+{
+    return _mm512_permutexvar_epi32(idx, v);
+}
+
+Vc_INTRINSIC __m512i permute_var(size_constant<8>, __m512i v, __m512i idx)
+{
+    return _mm512_permutexvar_epi64(idx, v);
+}
+#endif  // Vc_HAVE_AVX512F
+//}}}1
+}  // namespace x86
+#endif  // Vc_HAVE_SSE2
+
+// permute_impl {{{1
+// The generic case reads the entries one by one.
+template <class T, class A, int... I>
+Vc_INTRINSIC datapar<T, A> permute_impl(permutation<I...>, const datapar<T, A> &x)
+{
+    return datapar<T, A>([&](auto i) -> T { return x[permutation<I...>::idx[i]]; });
+}
+
+template <class T, class A, class U, class B>
+Vc_INTRINSIC datapar<T, A> permute_impl(const datapar<T, A> &x, const datapar<U, B> &idx)
+{
+    return datapar<T, A>([&](auto i) -> T { return x[idx[i]]; });
+}
+
+#ifdef Vc_HAVE_SSE_ABI
+template <class T, int... I>
+Vc_INTRINSIC datapar<T, datapar_abi::sse> permute_impl(permutation<I...> p,
+                                                       const datapar<T, datapar_abi::sse> &x)
+{
+    return datapar<T, datapar_abi::sse>(x86::permute(p, data(x).v()));
+}
+#endif  // Vc_HAVE_SSE_ABI
+
+#ifdef Vc_HAVE_AVX_ABI
+template <class T, int... I>
+Vc_INTRINSIC datapar<T, datapar_abi::avx> permute_impl(permutation<I...> p,
+                                                       const datapar<T, datapar_abi::avx> &x)
+{
+    return datapar<T, datapar_abi::avx>(x86::permute(p, data(x).v()));
+}
+#endif  // Vc_HAVE_AVX_ABI
+
+#ifdef Vc_HAVE_AVX512_ABI
+template <class T, int... I>
+Vc_INTRINSIC datapar<T, datapar_abi::avx512> permute_impl(
+    permutation<I...> p, const datapar<T, datapar_abi::avx512> &x)
+{
+    return datapar<T, datapar_abi::avx512>(x86::permute(p, data(x).v()));
+}
+#endif  // Vc_HAVE_AVX512_ABI
+
+// The runtime variants below require index entries of the same size as the value entries.
+template <class T, class U, class A>
+using native_permute_var = enable_if<sizeof(T) == sizeof(U), datapar<T, A>>;
+
+#if defined Vc_HAVE_SSE_ABI && defined Vc_HAVE_SSSE3
+template <class T, class U>
+Vc_INTRINSIC native_permute_var<T, U, datapar_abi::sse> permute_impl(
+    const datapar<T, datapar_abi::sse> &x, const datapar<U, datapar_abi::sse> &idx)
+{
+    using V = datapar<T, datapar_abi::sse>;
+    return V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(x86::permute_var(
+        size_tag<sizeof(T)>, x86::intrin_cast<__m128i>(data(x).v()), data(idx).v())));
+}
+#endif  // Vc_HAVE_SSE_ABI && Vc_HAVE_SSSE3
+
+#if defined Vc_HAVE_AVX_ABI && defined Vc_HAVE_AVX2
+template <class T, class U>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), native_permute_var<T, U, datapar_abi::avx>>
+permute_impl(const datapar<T, datapar_abi::avx> &x, const datapar<U, datapar_abi::avx> &idx)
+{
+    using V = datapar<T, datapar_abi::avx>;
+    return V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(x86::permute_var(
+        size_tag<sizeof(T)>, x86::intrin_cast<__m256i>(data(x).v()), data(idx).v())));
+}
+#endif  // Vc_HAVE_AVX_ABI && Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512_ABI
+#ifdef Vc_HAVE_AVX512BW
+template <class T, class U>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 2), native_permute_var<T, U, datapar_abi::avx512>>
+#else   // Vc_HAVE_AVX512BW
+template <class T, class U>
+Vc_INTRINSIC enable_if<(sizeof(T) >= 4), native_permute_var<T, U, datapar_abi::avx512>>
+#endif  // Vc_HAVE_AVX512BW
+permute_impl(const datapar<T, datapar_abi::avx512> &x,
+             const datapar<U, datapar_abi::avx512> &idx)
+{
+    using V = datapar<T, datapar_abi::avx512>;
+    return V(x86::intrin_cast<x86::intrinsic_type<T, V::size()>>(x86::permute_var(
+        size_tag<sizeof(T)>, x86::intrin_cast<__m512i>(data(x).v()), data(idx).v())));
+}
+#endif  // Vc_HAVE_AVX512_ABI
+//}}}1
+}  // namespace detail
+
+// permute {{{1
+// Returns a datapar object where entry i is x[Indexes[i]]. The indexes must be constant
+// and in the range [0, size()).
+template <int... Indexes, class T, class A>
+Vc_INTRINSIC enable_if<sizeof...(Indexes) == datapar_size_v<T, A>, datapar<T, A>> permute(
+    const datapar<T, A> &x)
+{
+    static_assert(detail::permutation<Indexes...>::in_range(),
+                  "permute indexes must be in the range [0, size())");
+    return detail::permute_impl(detail::permutation<Indexes...>(), x);
+}
+
+// Returns a datapar object where entry i is x[idx[i]]. All idx entries must be in the range
+// [0, size()).
+template <class T, class A, class U, class B>
+Vc_INTRINSIC enable_if<std::is_integral<U>::value &&
+                           datapar_size_v<U, B> == datapar_size_v<T, A>,
+                       datapar<T, A>>
+permute(const datapar<T, A> &x, const datapar<U, B> &idx)
+{
+    return detail::permute_impl(x, idx);
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_PERMUTE_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,208 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_SATURATED_CAST_H_
+#define VC_DATAPAR_SATURATED_CAST_H_
+
+#include "synopsis.h"
+#include "split_concat.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+#ifdef Vc_HAVE_SSE2
+namespace x86
+{
+// clamp_above {{{1
+// Returns min(a, m) for unsigned entries.
+Vc_INTRINSIC __m128i clamp_above(x_u16 a, ushort m)
+{
+#ifdef Vc_HAVE_SSE4_1
+    return _mm_min_epu16(a, _mm_set1_epi16(m));
+#else   // Vc_HAVE_SSE4_1
+    return _mm_sub_epi16(a, _mm_subs_epu16(a, _mm_set1_epi16(m)));
+#endif  // Vc_HAVE_SSE4_1
+}
+#ifdef Vc_HAVE_SSE4_1
+Vc_INTRINSIC __m128i clamp_above(x_u32 a, uint m) { return _mm_min_epu32(a, _mm_set1_epi32(m)); }
+#endif  // Vc_HAVE_SSE4_1
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i clamp_above(y_u16 a, ushort m) { return _mm256_min_epu16(a, _mm256_set1_epi16(m)); }
+Vc_INTRINSIC __m256i clamp_above(y_u32 a, uint   m) { return _mm256_min_epu32(a, _mm256_set1_epi32(m)); }
+#endif  // Vc_HAVE_AVX2
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i clamp_above(z_u16 a, ushort m) { return _mm512_min_epu16(a, _mm512_set1_epi16(m)); }
+Vc_INTRINSIC __m512i clamp_above(z_u32 a, uint   m) { return _mm512_min_epu32(a, _mm512_set1_epi32(m)); }
+#endif  // Vc_HAVE_AVX512BW
+
+// pack_sat {{{1
+// Returns the entries of a followed by the entries of b, converted with saturation to the
+// integer type of half the size. Unsigned sources are clamped to the signed range first,
+// since pack(u)s interprets its input as signed.
+Vc_INTRINSIC __m128i pack_sat(schar  *, x_i16 a, x_i16 b) { return _mm_packs_epi16 (a, b); }
+Vc_INTRINSIC __m128i pack_sat(uchar  *, x_i16 a, x_i16 b) { return _mm_packus_epi16(a, b); }
+Vc_INTRINSIC __m128i pack_sat(schar  *, x_u16 a, x_u16 b) { return _mm_packs_epi16 (clamp_above(a, 0x7f), clamp_above(b, 0x7f)); }
+Vc_INTRINSIC __m128i pack_sat(uchar  *, x_u16 a, x_u16 b) { return _mm_packus_epi16(clamp_above(a, 0xff), clamp_above(b, 0xff)); }
+Vc_INTRINSIC __m128i pack_sat(short  *, x_i32 a, x_i32 b) { return _mm_packs_epi32 (a, b); }
+#ifdef Vc_HAVE_SSE4_1
+Vc_INTRINSIC __m128i pack_sat(ushort *, x_i32 a, x_i32 b) { return _mm_packus_epi32(a, b); }
+Vc_INTRINSIC __m128i pack_sat(short  *, x_u32 a, x_u32 b) { return _mm_packs_epi32 (clamp_above(a, 0x7fff), clamp_above(b, 0x7fff)); }
+Vc_INTRINSIC __m128i pack_sat(ushort *, x_u32 a, x_u32 b) { return _mm_packus_epi32(clamp_above(a, 0xffff), clamp_above(b, 0xffff)); }
+#endif  // Vc_HAVE_SSE4_1
+
+// The 256- and 512-bit instructions pack within 128-bit lanes, which interleaves the 64-bit
+// pieces of a and b. One permutation restores the order.
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i fix_pack_order(__m256i x) { return _mm256_permute4x64_epi64(x, 0xd8); }
+Vc_INTRINSIC __m256i pack_sat(schar  *, y_i16 a, y_i16 b) { return fix_pack_order(_mm256_packs_epi16 (a, b)); }
+Vc_INTRINSIC __m256i pack_sat(uchar  *, y_i16 a, y_i16 b) { return fix_pack_order(_mm256_packus_epi16(a, b)); }
+Vc_INTRINSIC __m256i pack_sat(schar  *, y_u16 a, y_u16 b) { return fix_pack_order(_mm256_packs_epi16 (clamp_above(a, 0x7f), clamp_above(b, 0x7f))); }
+Vc_INTRINSIC __m256i pack_sat(uchar  *, y_u16 a, y_u16 b) { return fix_pack_order(_mm256_packus_epi16(clamp_above(a, 0xff), clamp_above(b, 0xff))); }
+Vc_INTRINSIC __m256i pack_sat(short  *, y_i32 a, y_i32 b) { return fix_pack_order(_mm256_packs_epi32 (a, b)); }
+Vc_INTRINSIC __m256i pack_sat(ushort *, y_i32 a, y_i32 b) { return fix_pack_order(_mm256_packus_epi32(a, b)); }
+Vc_INTRINSIC __m256i pack_sat(short  *, y_u32 a, y_u32 b) { return fix_pack_order(_mm256_packs_epi32 (clamp_above(a, 0x7fff), clamp_above(b, 0x7fff))); }
+Vc_INTRINSIC __m256i pack_sat(ushort *, y_u32 a, y_u32 b) { return fix_pack_order(_mm256_packus_epi32(clamp_above(a, 0xffff), clamp_above(b, 0xffff))); }
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i fix_pack_order(__m512i x)
+{
+    return _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), x);
+}
+Vc_INTRINSIC __m512i pack_sat(schar  *, z_i16 a, z_i16 b) { return fix_pack_order(_mm512_packs_epi16 (a, b)); }
+Vc_INTRINSIC __m512i pack_sat(uchar  *, z_i16 a, z_i16 b) { return fix_pack_order(_mm512_packus_epi16(a, b)); }
+Vc_INTRINSIC __m512i pack_sat(schar  *, z_u16 a, z_u16 b) { return fix_pack_order(_mm512_packs_epi16 (clamp_above(a, 0x7f), clamp_above(b, 0x7f))); }
+Vc_INTRINSIC __m512i pack_sat(uchar  *, z_u16 a, z_u16 b) { return fix_pack_order(_mm512_packus_epi16(clamp_above(a, 0xff), clamp_above(b, 0xff))); }
+Vc_INTRINSIC __m512i pack_sat(short  *, z_i32 a, z_i32 b) { return fix_pack_order(_mm512_packs_epi32 (a, b)); }
+Vc_INTRINSIC __m512i pack_sat(ushort *, z_i32 a, z_i32 b) { return fix_pack_order(_mm512_packus_epi32(a, b)); }
+Vc_INTRINSIC __m512i pack_sat(short  *, z_u32 a, z_u32 b) { return fix_pack_order(_mm512_packs_epi32 (clamp_above(a, 0x7fff), clamp_above(b, 0x7fff))); }
+Vc_INTRINSIC __m512i pack_sat(ushort *, z_u32 a, z_u32 b) { return fix_pack_order(_mm512_packus_epi32(clamp_above(a, 0xffff), clamp_above(b, 0xffff))); }
+#endif  // Vc_HAVE_AVX512BW
+//}}}1
+}  // namespace x86
+#endif  // Vc_HAVE_SSE2
+
+// saturated_cast_impl {{{1
+// The generic case converts entry by entry.
+template <class V, class T, class... As>
+Vc_INTRINSIC V saturated_cast_impl(V *, const datapar<T, As> &... xs)
+{
+    using U = typename V::value_type;
+    const auto x = concat(xs...);
+    return V([&](auto i) { return saturate<U>(T(x[i])); });
+}
+
+// Two registers of T pack into one register of U.
+#ifdef Vc_HAVE_SSE_ABI
+template <class U, class T>
+Vc_INTRINSIC auto saturated_cast_impl(datapar<U, datapar_abi::sse> *,
+                                      const datapar<T, datapar_abi::sse> &a,
+                                      const datapar<T, datapar_abi::sse> &b)
+    -> decltype(x86::pack_sat(static_cast<U *>(nullptr), data(a), data(b)),
+                datapar<U, datapar_abi::sse>())
+{
+    return datapar<U, datapar_abi::sse>(
+        x86::pack_sat(static_cast<U *>(nullptr), data(a), data(b)));
+}
+#endif  // Vc_HAVE_SSE_ABI
+
+#ifdef Vc_HAVE_AVX_ABI
+template <class U, class T>
+Vc_INTRINSIC auto saturated_cast_impl(datapar<U, datapar_abi::avx> *,
+                                      const datapar<T, datapar_abi::avx> &a,
+                                      const datapar<T, datapar_abi::avx> &b)
+    -> decltype(x86::pack_sat(static_cast<U *>(nullptr), data(a), data(b)),
+                datapar<U, datapar_abi::avx>())
+{
+    return datapar<U, datapar_abi::avx>(
+        x86::pack_sat(static_cast<U *>(nullptr), data(a), data(b)));
+}
+
+// One AVX register of T narrows to one SSE register of U.
+template <class U, class T>
+Vc_INTRINSIC auto saturated_cast_impl(datapar<U, datapar_abi::sse> *,
+                                      const datapar<T, datapar_abi::avx> &x)
+    -> decltype(x86::pack_sat(static_cast<U *>(nullptr), Storage<T, 16 / sizeof(T)>(),
+                              Storage<T, 16 / sizeof(T)>()),
+                datapar<U, datapar_abi::sse>())
+{
+    using H = Storage<T, 16 / sizeof(T)>;
+    const auto v = data(x).v();
+    return datapar<U, datapar_abi::sse>(
+        x86::pack_sat(static_cast<U *>(nullptr), H(x86::lo128(v)), H(x86::hi128(v))));
+}
+#endif  // Vc_HAVE_AVX_ABI
+
+#ifdef Vc_HAVE_AVX512_ABI
+template <class U, class T>
+Vc_INTRINSIC auto saturated_cast_impl(datapar<U, datapar_abi::avx512> *,
+                                      const datapar<T, datapar_abi::avx512> &a,
+                                      const datapar<T, datapar_abi::avx512> &b)
+    -> decltype(x86::pack_sat(static_cast<U *>(nullptr), data(a), data(b)),
+                datapar<U, datapar_abi::avx512>())
+{
+    return datapar<U, datapar_abi::avx512>(
+        x86::pack_sat(static_cast<U *>(nullptr), data(a), data(b)));
+}
+
+// One AVX-512 register of T narrows to one AVX register of U.
+template <class U, class T>
+Vc_INTRINSIC auto saturated_cast_impl(datapar<U, datapar_abi::avx> *,
+                                      const datapar<T, datapar_abi::avx512> &x)
+    -> decltype(x86::pack_sat(static_cast<U *>(nullptr), Storage<T, 32 / sizeof(T)>(),
+                              Storage<T, 32 / sizeof(T)>()),
+                datapar<U, datapar_abi::avx>())
+{
+    using H = Storage<T, 32 / sizeof(T)>;
+    const auto v = data(x).v();
+    return datapar<U, datapar_abi::avx>(
+        x86::pack_sat(static_cast<U *>(nullptr), H(x86::lo256(v)), H(x86::hi256(v))));
+}
+#endif  // Vc_HAVE_AVX512_ABI
+//}}}1
+}  // namespace detail
+
+// saturated_datapar_cast {{{1
+// Returns the entries of all arguments, in the order of the arguments, converted to the
+// value_type of V. Values outside its range are clamped to the nearest representable value
+// instead of wrapping around. The arguments must have V::size() entries in total. (non-std)
+template <class V, class T, class A, class... As>
+Vc_INTRINSIC enable_if<is_datapar_v<V> && std::is_integral<T>::value &&
+                           std::is_integral<typename V::value_type>::value &&
+                           V::size() == detail::sum(datapar_size_v<T, A>,
+                                                    datapar_size_v<T, As>...),
+                       V>
+saturated_datapar_cast(const datapar<T, A> &x, const datapar<T, As> &... xs)
+{
+    return detail::saturated_cast_impl(static_cast<V *>(nullptr), x, xs...);
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_SATURATED_CAST_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,212 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_SCAN_H_
+#define VC_DATAPAR_SCAN_H_
+
+#include <iterator>
+#include <memory>
+#include "synopsis.h"
+#include "permute.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// lanes_below {{{1
+// Returns the mask of the entries with index less than S.
+// The mask is a compare of the entry indexes against S, not of generated 0/1 entries against
+// zero: GCC 12 combines the blend with the inverted result of the latter (cmpeq, then not)
+// into a pblendvb on the non-inverted mask without swapping the blend operands, i.e. it
+// assigns to the complement of the mask on AVX-512 targets.
+template <size_t S, class T, class A> Vc_INTRINSIC mask<T, A> lanes_below()
+{
+    return datapar<T, A>([](auto i) { return T(i); }) < T(S);
+}
+
+// shift_lanes_up {{{1
+// Returns x with entry i moved to i + S. The entries below S are zero.
+template <size_t S, class T, class A, size_t... I>
+Vc_INTRINSIC datapar<T, A> shift_lanes_up(const datapar<T, A> &x, std::index_sequence<I...>)
+{
+    datapar<T, A> r = permute<(I >= S ? int(I - S) : int(I))...>(x);
+    where(lanes_below<S, T, A>(), r) = T();
+    return r;
+}
+
+template <size_t S, class T, class A>
+Vc_INTRINSIC datapar<T, A> shift_lanes_up(const datapar<T, A> &x)
+{
+    return shift_lanes_up<S>(x, std::make_index_sequence<datapar_size_v<T, A>>());
+}
+
+#ifdef Vc_HAVE_SSE_ABI
+template <size_t S, class T>
+Vc_INTRINSIC datapar<T, datapar_abi::sse> shift_lanes_up(const datapar<T, datapar_abi::sse> &x)
+{
+    return datapar<T, datapar_abi::sse>(x86::shift_left<S * sizeof(T)>(data(x).v()));
+}
+#endif  // Vc_HAVE_SSE_ABI
+
+#if defined Vc_HAVE_AVX_ABI && defined Vc_HAVE_AVX2
+template <size_t S, class T>
+Vc_INTRINSIC datapar<T, datapar_abi::avx> shift_lanes_up(const datapar<T, datapar_abi::avx> &x)
+{
+    return datapar<T, datapar_abi::avx>(x86::shift_left<S * sizeof(T)>(data(x).v()));
+}
+#endif  // Vc_HAVE_AVX_ABI && Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512_ABI
+template <size_t S, class T>
+Vc_INTRINSIC datapar<T, datapar_abi::avx512> shift_lanes_up(
+    const datapar<T, datapar_abi::avx512> &x)
+{
+    return datapar<T, datapar_abi::avx512>(x86::shift_left<S * sizeof(T)>(data(x).v()));
+}
+#endif  // Vc_HAVE_AVX512_ABI
+
+// scan_step {{{1
+// The operations with neutral element 0 need no masking of the entries the shift fills with
+// zeros. This does not hold for floating-point addition, since -0. + 0. is +0.
+template <class T, class BinaryOperation> struct zero_is_neutral : std::false_type {};
+template <class T, class X>
+struct zero_is_neutral<T, std::plus<X>> : std::is_integral<T> {};
+template <class T, class X>
+struct zero_is_neutral<T, std::bit_or<X>> : std::is_integral<T> {};
+template <class T, class X>
+struct zero_is_neutral<T, std::bit_xor<X>> : std::is_integral<T> {};
+
+template <size_t S, class T, class A, class BinaryOperation>
+Vc_INTRINSIC void scan_step(datapar<T, A> &x, BinaryOperation &binary_op, std::true_type)
+{
+    x = binary_op(shift_lanes_up<S>(x), x);
+}
+
+template <size_t S, class T, class A, class BinaryOperation>
+Vc_INTRINSIC void scan_step(datapar<T, A> &x, BinaryOperation &binary_op, std::false_type)
+{
+    datapar<T, A> r = binary_op(shift_lanes_up<S>(x), x);
+    where(lanes_below<S, T, A>(), r) = x;
+    x = r;
+}
+
+// inclusive_scan_impl {{{1
+// Hillis-Steele scan: step S combines every entry with the one S entries below it.
+template <size_t S, class T, class A, class BinaryOperation>
+Vc_INTRINSIC enable_if<(S >= datapar_size_v<T, A>), datapar<T, A>> inclusive_scan_impl(
+    const datapar<T, A> &x, BinaryOperation &)
+{
+    return x;
+}
+
+template <size_t S, class T, class A, class BinaryOperation>
+Vc_INTRINSIC enable_if<(S < datapar_size_v<T, A>), datapar<T, A>> inclusive_scan_impl(
+    datapar<T, A> x, BinaryOperation &binary_op)
+{
+    scan_step<S>(x, binary_op, zero_is_neutral<T, BinaryOperation>());
+    return inclusive_scan_impl<2 * S>(x, binary_op);
+}
+
+// broadcast_last {{{1
+template <class T, class A, size_t... I>
+Vc_INTRINSIC datapar<T, A> broadcast_last(const datapar<T, A> &x, std::index_sequence<I...>)
+{
+    return permute<int(I * 0 + sizeof...(I) - 1)...>(x);
+}
+
+// inclusive_scan_range {{{1
+// The running total is kept broadcast in a register, such that every vector only needs its
+// in-register scan and one more binary_op.
+template <class T, class BinaryOperation>
+T *inclusive_scan_range(const T *first, size_t n, T *out, BinaryOperation &binary_op)
+{
+    using V = native_datapar<T>;
+    size_t i = 0;
+    if (n >= V::size()) {
+        V sum = inclusive_scan_impl<1>(V(first, flags::element_aligned), binary_op);
+        sum.memstore(out, flags::element_aligned);
+        for (i = V::size(); i + V::size() <= n; i += V::size()) {
+            const V carry = broadcast_last(sum, std::make_index_sequence<V::size()>());
+            sum = binary_op(carry,
+                            inclusive_scan_impl<1>(V(first + i, flags::element_aligned),
+                                                   binary_op));
+            sum.memstore(out + i, flags::element_aligned);
+        }
+    }
+    for (; i < n; ++i) {
+        out[i] = i == 0 ? first[0] : static_cast<T>(binary_op(out[i - 1], first[i]));
+    }
+    return out + n;
+}
+//}}}1
+}  // namespace detail
+
+// inclusive_scan {{{1
+// Returns the prefix sums of x: entry i is x[0] op x[1] op ... op x[i]. binary_op must be
+// associative and is called with datapar arguments. (non-std)
+template <class BinaryOperation = std::plus<>, class T, class A>
+Vc_INTRINSIC datapar<T, A> inclusive_scan(const datapar<T, A> &x,
+                                          BinaryOperation binary_op = BinaryOperation())
+{
+    return detail::inclusive_scan_impl<1>(x, binary_op);
+}
+
+// Writes the prefix sums of the contiguous range [first, last) to the contiguous range
+// starting at out, which may be equal to first, and returns the end of the output range.
+// binary_op is called with datapar and scalar arguments. (non-std)
+template <class ContiguousIterator, class ContiguousOutputIterator,
+          class BinaryOperation = std::plus<>>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          ContiguousOutputIterator>
+inclusive_scan(ContiguousIterator first, ContiguousIterator last,
+               ContiguousOutputIterator out, BinaryOperation binary_op = BinaryOperation())
+{
+    const auto n = last - first;
+    if (n > 0) {
+        detail::inclusive_scan_range(std::addressof(*first), size_t(n),
+                                     std::addressof(*out), binary_op);
+    }
+    return out + n;
+}
+
+// exclusive_scan {{{1
+// Returns the prefix sums of x that exclude the own entry: entry 0 is init and entry i is
+// init op x[0] op ... op x[i - 1]. (non-std)
+template <class BinaryOperation = std::plus<>, class T, class A>
+Vc_INTRINSIC datapar<T, A> exclusive_scan(
+    const datapar<T, A> &x, BinaryOperation binary_op = BinaryOperation(),
+    T init = detail::default_neutral_element<T, BinaryOperation>::value)
+{
+    datapar<T, A> r = detail::shift_lanes_up<1>(x);
+    where(detail::lanes_below<1, T, A>(), r) = init;
+    return detail::inclusive_scan_impl<1>(r, binary_op);
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_SCAN_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,650 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_SIMDIZE_H_
+#define VC_DATAPAR_SIMDIZE_H_
+
+#include "synopsis.h"
+#include "interleave.h"
+#include <array>
+#include <memory>
+#include <tuple>
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+template <class T, size_t N, class MT> struct simdize_impl;
+template <class Scalar, class Base, size_t N> class adapter;
+
+// determine_tuple_size {{{1
+// The number of members of T, taken from either std::tuple_size<T> or the tuple_size
+// enumerator that Vc_SIMDIZE_INTERFACE declares.
+template <class T, size_t TupleSize = std::tuple_size<T>::value>
+constexpr size_t determine_tuple_size()
+{
+    return TupleSize;
+}
+template <class T, size_t TupleSize = T::tuple_size>
+constexpr size_t determine_tuple_size(size_t = T::tuple_size)
+{
+    return TupleSize;
+}
+
+// get_dispatcher {{{1
+// Member access via vc_get_<I>() if T uses Vc_SIMDIZE_INTERFACE, otherwise via std::get.
+template <size_t I, class T, class R = decltype(std::declval<T &>().template vc_get_<I>())>
+Vc_INTRINSIC R get_dispatcher(T &x, void * = nullptr)
+{
+    return x.template vc_get_<I>();
+}
+template <size_t I, class T,
+          class R = decltype(std::declval<const T &>().template vc_get_<I>())>
+Vc_INTRINSIC R get_dispatcher(const T &x, void * = nullptr)
+{
+    return x.template vc_get_<I>();
+}
+template <size_t I, class T, class R = decltype(std::get<I>(std::declval<T &>()))>
+Vc_INTRINSIC R get_dispatcher(T &x, int = 0)
+{
+    return std::get<I>(x);
+}
+template <size_t I, class T, class R = decltype(std::get<I>(std::declval<const T &>()))>
+Vc_INTRINSIC R get_dispatcher(const T &x, int = 0)
+{
+    return std::get<I>(x);
+}
+
+template <size_t I, class T>
+using member_type = std::decay_t<decltype(get_dispatcher<I>(std::declval<T &>()))>;
+
+// simdize_size {{{1
+// The number of entries of a simdized type, or 0 if T was left unchanged.
+template <class T> struct simdize_size : public size_constant<0> {};
+template <class T, class A>
+struct simdize_size<datapar<T, A>> : public size_constant<datapar_size_v<T, A>> {};
+template <class T, class A>
+struct simdize_size<mask<T, A>> : public size_constant<datapar_size_v<T, A>> {};
+template <class S, class B, size_t N>
+struct simdize_size<adapter<S, B, N>> : public size_constant<N> {};
+
+// typelist / substitute_one_by_one {{{1
+// Replaces the template arguments of a class template one after another. The first
+// member that gets vectorized determines the number of entries N (unless N was given),
+// the first arithmetic member determines the mask type MT for bool members (unless MT
+// was given).
+template <class... Ts> struct typelist;
+
+template <size_t N, class MT, class Done, class... Remaining> struct substitute_one_by_one;
+template <size_t N_, class MT, class... Done>
+struct substitute_one_by_one<N_, MT, typelist<Done...>> {
+    static constexpr size_t N = N_;
+    template <template <class...> class C> using substituted = C<Done...>;
+};
+template <size_t N_, class MT, class... Done, class T, class... Remaining>
+struct substitute_one_by_one<N_, MT, typelist<Done...>, T, Remaining...> {
+private:
+    using V = typename simdize_impl<T, N_, MT>::type;
+    using next = substitute_one_by_one<
+        (N_ != 0 ? N_ : simdize_size<V>::value),
+        std::conditional_t<std::is_void<MT>::value && std::is_arithmetic<T>::value &&
+                               !std::is_same<T, bool>::value,
+                           T, MT>,
+        typelist<Done..., V>, Remaining...>;
+
+public:
+    static constexpr size_t N = next::N;
+    template <template <class...> class C>
+    using substituted = typename next::template substituted<C>;
+};
+
+// simdize_impl {{{1
+// Types that cannot be vectorized are left unchanged.
+template <class T, size_t N, class MT> struct simdize_impl {
+    using type = T;
+};
+
+// Arithmetic types are replaced by datapar.
+template <class T, size_t N, class MT, bool = std::is_arithmetic<T>::value>
+struct simdize_arithmetic {
+    using type = T;
+};
+template <class T, class MT> struct simdize_arithmetic<T, 0, MT, true> {
+    using type = native_datapar<T>;
+};
+template <class T, size_t N, class MT> struct simdize_arithmetic<T, N, MT, true> {
+    using type = datapar<T, abi_for_size_t<T, N>>;
+};
+#define Vc_SIMDIZE_ARITHMETIC_(T_)                                                       \
+    template <size_t N, class MT> struct simdize_impl<T_, N, MT>                         \
+        : public simdize_arithmetic<T_, N, MT> {                                         \
+    }
+Vc_SIMDIZE_ARITHMETIC_(char);
+Vc_SIMDIZE_ARITHMETIC_(wchar_t);
+Vc_SIMDIZE_ARITHMETIC_(char16_t);
+Vc_SIMDIZE_ARITHMETIC_(char32_t);
+Vc_SIMDIZE_ARITHMETIC_(signed char);
+Vc_SIMDIZE_ARITHMETIC_(unsigned char);
+Vc_SIMDIZE_ARITHMETIC_(short);
+Vc_SIMDIZE_ARITHMETIC_(unsigned short);
+Vc_SIMDIZE_ARITHMETIC_(int);
+Vc_SIMDIZE_ARITHMETIC_(unsigned int);
+Vc_SIMDIZE_ARITHMETIC_(long);
+Vc_SIMDIZE_ARITHMETIC_(unsigned long);
+Vc_SIMDIZE_ARITHMETIC_(long long);
+Vc_SIMDIZE_ARITHMETIC_(unsigned long long);
+Vc_SIMDIZE_ARITHMETIC_(float);
+Vc_SIMDIZE_ARITHMETIC_(double);
+Vc_SIMDIZE_ARITHMETIC_(long double);
+#undef Vc_SIMDIZE_ARITHMETIC_
+
+// bool is replaced by a mask with value_type MT (float if MT is void).
+template <size_t N, class MT> struct simdize_impl<bool, N, MT> {
+    using T = std::conditional_t<std::is_void<MT>::value, float, MT>;
+    using type =
+        std::conditional_t<N == 0, native_mask<T>, mask<T, abi_for_size_t<T, (N == 0 ? 1 : N)>>>;
+};
+
+// datapar and mask types are already vectorized.
+template <class T, class A, size_t N, class MT> struct simdize_impl<datapar<T, A>, N, MT> {
+    using type = datapar<T, A>;
+};
+template <class T, class A, size_t N, class MT> struct simdize_impl<mask<T, A>, N, MT> {
+    using type = mask<T, A>;
+};
+
+// Class templates with type parameters get their arguments substituted. The result is an
+// adapter deriving from the substituted class template, if anything was substituted.
+template <template <class...> class C, class... Ts, size_t N, class MT>
+struct simdize_impl<C<Ts...>, N, MT> {
+private:
+    using substitution = substitute_one_by_one<N, MT, typelist<>, Ts...>;
+    using vectorized = typename substitution::template substituted<C>;
+
+public:
+    using type = std::conditional_t<std::is_same<C<Ts...>, vectorized>::value, C<Ts...>,
+                                    adapter<C<Ts...>, vectorized, substitution::N>>;
+};
+
+// std::array<T, K> becomes an adapter deriving from std::array<simdize<T>, K>.
+template <class T, size_t K, size_t N, class MT>
+struct simdize_impl<std::array<T, K>, N, MT> {
+private:
+    using V = typename simdize_impl<T, N, MT>::type;
+
+public:
+    using type = std::conditional_t<std::is_same<T, V>::value, std::array<T, K>,
+                                    adapter<std::array<T, K>, std::array<V, K>,
+                                            simdize_size<V>::value>>;
+};
+
+// is_interleavable {{{1
+// Memory access via interleaved_load/store requires all members to be of the same
+// datapar type and Scalar to consist of nothing but those members.
+template <class Scalar, class... Ms> struct is_interleavable : public std::false_type {};
+template <class Scalar, class T, class A, class... Ms>
+struct is_interleavable<Scalar, datapar<T, A>, Ms...>
+    : public bool_constant<(sizeof...(Ms) > 0 &&
+                            conjunction<std::is_same<datapar<T, A>, Ms>...>::value &&
+                            sizeof(Scalar) == (1 + sizeof...(Ms)) * sizeof(T))> {
+};
+
+// adapter {{{1
+// The simdized type of Scalar. It derives from Base, the vectorized instantiation of the
+// class template of Scalar, and thus inherits all its member functions, which now
+// operate on N objects at once.
+template <class Scalar, class Base, size_t N> class adapter : public Base
+{
+    static constexpr size_t tuple_size = determine_tuple_size<Scalar>();
+    using index_seq = std::make_index_sequence<tuple_size>;
+
+    // broadcast helpers: every member is constructed explicitly from the corresponding
+    // member of scalar; Base is initialized with parenthesis if possible, braces
+    // otherwise
+    template <size_t... I>
+    adapter(private_init_t, std::index_sequence<I...>, const Scalar &scalar,
+            std::true_type)
+        : Base(member_type<I, Base>(get_dispatcher<I>(scalar))...)
+    {
+    }
+    template <size_t... I>
+    adapter(private_init_t, std::index_sequence<I...>, const Scalar &scalar,
+            std::false_type)
+        : Base{member_type<I, Base>(get_dispatcher<I>(scalar))...}
+    {
+    }
+    template <size_t... I>
+    static std::is_constructible<Base, member_type<I, Base>...> paren_init(
+        std::index_sequence<I...>);
+
+    template <size_t... I>
+    static is_interleavable<Scalar, member_type<I, Base>...> interleavable(
+        std::index_sequence<I...>);
+    using use_interleaved = decltype(interleavable(index_seq()));
+    using first_member = member_type<0, Base>;
+
+    // true if the members of Scalar are laid out in order, without padding
+    template <size_t... I>
+    static Vc_INTRINSIC bool is_contiguous(const Scalar &scalar, std::index_sequence<I...>)
+    {
+        using T = typename first_member::value_type;
+        const char *const base = reinterpret_cast<const char *>(std::addressof(scalar));
+        bool r = true;
+        unused(std::initializer_list<bool>{
+            (r = r && reinterpret_cast<const char *>(std::addressof(
+                          get_dispatcher<I>(scalar))) == base + I * sizeof(T))...});
+        return r;
+    }
+
+    template <size_t... I>
+    Vc_INTRINSIC void memload_impl(std::true_type, const Scalar *mem, std::index_sequence<I...>)
+    {
+        using T = typename first_member::value_type;
+        if (is_contiguous(mem[0], index_seq())) {
+            interleaved_load(reinterpret_cast<const T *>(mem), get_dispatcher<I>(*this)...);
+        } else {
+            memload_impl(std::false_type(), mem, index_seq());
+        }
+    }
+    template <size_t... I>
+    Vc_INTRINSIC void memload_impl(std::false_type, const Scalar *mem, std::index_sequence<I...>)
+    {
+        for (size_t i = 0; i < N; ++i) {
+            assign(*this, i, mem[i]);
+        }
+    }
+    template <size_t... I>
+    Vc_INTRINSIC void memstore_impl(std::true_type, Scalar *mem, std::index_sequence<I...>) const
+    {
+        using T = typename first_member::value_type;
+        if (is_contiguous(mem[0], index_seq())) {
+            interleaved_store(reinterpret_cast<T *>(mem), get_dispatcher<I>(*this)...);
+        } else {
+            memstore_impl(std::false_type(), mem, index_seq());
+        }
+    }
+    template <size_t... I>
+    Vc_INTRINSIC void memstore_impl(std::false_type, Scalar *mem, std::index_sequence<I...>) const
+    {
+        for (size_t i = 0; i < N; ++i) {
+            mem[i] = extract(*this, i);
+        }
+    }
+    template <class I, class IA, size_t... Is>
+    Vc_INTRINSIC void gather_impl(std::true_type, const Scalar *mem,
+                                  const datapar<I, IA> &indexes, std::index_sequence<Is...>)
+    {
+        using T = typename first_member::value_type;
+        if (is_contiguous(mem[0], index_seq())) {
+            interleaved_gather(reinterpret_cast<const T *>(mem), indexes,
+                               get_dispatcher<Is>(*this)...);
+        } else {
+            gather_impl(std::false_type(), mem, indexes, index_seq());
+        }
+    }
+    template <class I, class IA, size_t... Is>
+    Vc_INTRINSIC void gather_impl(std::false_type, const Scalar *mem,
+                                  const datapar<I, IA> &indexes, std::index_sequence<Is...>)
+    {
+        for (size_t i = 0; i < N; ++i) {
+            assign(*this, i, mem[indexes[i]]);
+        }
+    }
+    template <class I, class IA, size_t... Is>
+    Vc_INTRINSIC void scatter_impl(std::true_type, Scalar *mem,
+                                   const datapar<I, IA> &indexes,
+                                   std::index_sequence<Is...>) const
+    {
+        using T = typename first_member::value_type;
+        if (is_contiguous(mem[0], index_seq())) {
+            interleaved_scatter(reinterpret_cast<T *>(mem), indexes,
+                                get_dispatcher<Is>(*this)...);
+        } else {
+            scatter_impl(std::false_type(), mem, indexes, index_seq());
+        }
+    }
+    template <class I, class IA, size_t... Is>
+    Vc_INTRINSIC void scatter_impl(std::false_type, Scalar *mem,
+                                   const datapar<I, IA> &indexes,
+                                   std::index_sequence<Is...>) const
+    {
+        for (size_t i = 0; i < N; ++i) {
+            mem[indexes[i]] = extract(*this, i);
+        }
+    }
+
+public:
+    static constexpr size_t size() { return N; }
+    using base_type = Base;
+    using scalar_type = Scalar;
+
+    adapter() = default;
+    adapter(const adapter &) = default;
+    adapter(adapter &&) = default;
+    adapter &operator=(const adapter &) = default;
+    adapter &operator=(adapter &&) = default;
+
+    // broadcast constructor
+    template <class U, class = enable_if<std::is_convertible<U, Scalar>::value>>
+    adapter(U &&init)
+        : adapter(private_init, index_seq(), static_cast<const Scalar &>(init),
+                  bool_constant<decltype(paren_init(index_seq()))::value>())
+    {
+    }
+
+    // forward all other constructors to Base
+    template <class A0, class... Args,
+              class = enable_if<!std::is_same<std::decay_t<A0>, private_init_t>::value &&
+                                !std::is_convertible<A0, const Scalar *>::value &&
+                                (sizeof...(Args) > 0 ||
+                                 (!std::is_convertible<A0, Scalar>::value &&
+                                  !std::is_same<std::decay_t<A0>, adapter>::value))>>
+    adapter(A0 &&arg0, Args &&... args)
+        : Base(std::forward<A0>(arg0), std::forward<Args>(args)...)
+    {
+    }
+
+    // load, store, gather, scatter of N consecutive / indexed Scalar objects (non-std)
+    Vc_INTRINSIC adapter(const Scalar *mem) { memload(mem); }
+    template <class I, class IA>
+    Vc_INTRINSIC adapter(const Scalar *mem, const datapar<I, IA> &indexes)
+    {
+        gather(mem, indexes);
+    }
+    Vc_INTRINSIC void memload(const Scalar *mem)
+    {
+        memload_impl(use_interleaved(), mem, index_seq());
+    }
+    Vc_INTRINSIC void memstore(Scalar *mem) const
+    {
+        memstore_impl(use_interleaved(), mem, index_seq());
+    }
+    template <class I, class IA>
+    Vc_INTRINSIC void gather(const Scalar *mem, const datapar<I, IA> &indexes)
+    {
+        static_assert(std::is_integral<I>::value && datapar_size_v<I, IA> == N,
+                      "gathers require an integral index vector of equal size");
+        gather_impl(use_interleaved(), mem, indexes, index_seq());
+    }
+    template <class I, class IA>
+    Vc_INTRINSIC void scatter(Scalar *mem, const datapar<I, IA> &indexes) const
+    {
+        static_assert(std::is_integral<I>::value && datapar_size_v<I, IA> == N,
+                      "scatters require an integral index vector of equal size");
+        scatter_impl(use_interleaved(), mem, indexes, index_seq());
+    }
+};
+
+// The tuple compares of std::tuple require bool results and thus cannot work.
+template <class... Ts, class... TVs, class... Us, class... UVs, size_t N>
+void operator==(const adapter<std::tuple<Ts...>, std::tuple<TVs...>, N> &,
+                const adapter<std::tuple<Us...>, std::tuple<UVs...>, N> &) = delete;
+template <class... Ts, class... TVs, class... Us, class... UVs, size_t N>
+void operator!=(const adapter<std::tuple<Ts...>, std::tuple<TVs...>, N> &,
+                const adapter<std::tuple<Us...>, std::tuple<UVs...>, N> &) = delete;
+template <class... Ts, class... TVs, class... Us, class... UVs, size_t N>
+void operator<(const adapter<std::tuple<Ts...>, std::tuple<TVs...>, N> &,
+               const adapter<std::tuple<Us...>, std::tuple<UVs...>, N> &) = delete;
+template <class... Ts, class... TVs, class... Us, class... UVs, size_t N>
+void operator<=(const adapter<std::tuple<Ts...>, std::tuple<TVs...>, N> &,
+                const adapter<std::tuple<Us...>, std::tuple<UVs...>, N> &) = delete;
+template <class... Ts, class... TVs, class... Us, class... UVs, size_t N>
+void operator>(const adapter<std::tuple<Ts...>, std::tuple<TVs...>, N> &,
+               const adapter<std::tuple<Us...>, std::tuple<UVs...>, N> &) = delete;
+template <class... Ts, class... TVs, class... Us, class... UVs, size_t N>
+void operator>=(const adapter<std::tuple<Ts...>, std::tuple<TVs...>, N> &,
+                const adapter<std::tuple<Us...>, std::tuple<UVs...>, N> &) = delete;
+
+// assign / extract {{{1
+// Entry-wise access to the members of a simdized object. Nested adapters recurse.
+template <class T, class A, class U>
+Vc_INTRINSIC void assign_member(datapar<T, A> &v, size_t i, const U &x)
+{
+    v[i] = x;
+}
+template <class T, class A>
+Vc_INTRINSIC void assign_member(mask<T, A> &k, size_t i, bool x)
+{
+    k[i] = x;
+}
+template <class S, class B, size_t N>
+Vc_INTRINSIC void assign_member(adapter<S, B, N> &a, size_t i, const S &x)
+{
+    assign(a, i, x);
+}
+template <class T, class A> Vc_INTRINSIC T extract_member(const datapar<T, A> &v, size_t i)
+{
+    return v[i];
+}
+template <class T, class A> Vc_INTRINSIC bool extract_member(const mask<T, A> &k, size_t i)
+{
+    return k[i];
+}
+template <class S, class B, size_t N>
+Vc_INTRINSIC S extract_member(const adapter<S, B, N> &a, size_t i)
+{
+    return extract(a, i);
+}
+
+template <class S, class B, size_t N, size_t... I>
+Vc_INTRINSIC void assign_impl(adapter<S, B, N> &a, size_t i, const S &x,
+                              std::index_sequence<I...>)
+{
+    unused(std::initializer_list<int>{
+        (assign_member(get_dispatcher<I>(a), i, get_dispatcher<I>(x)), 0)...});
+}
+template <class S, class B, size_t N, size_t... I>
+Vc_INTRINSIC S extract_impl(const adapter<S, B, N> &a, size_t i, std::index_sequence<I...>)
+{
+    return S{extract_member(get_dispatcher<I>(a), i)...};
+}
+
+// Sets entry i of a to x.
+template <class S, class B, size_t N>
+Vc_INTRINSIC void assign(adapter<S, B, N> &a, size_t i, const S &x)
+{
+    assign_impl(a, i, x, std::make_index_sequence<determine_tuple_size<S>()>());
+}
+
+// Returns entry i of a as a Scalar object.
+template <class S, class B, size_t N>
+Vc_INTRINSIC S extract(const adapter<S, B, N> &a, size_t i)
+{
+    return extract_impl(a, i, std::make_index_sequence<determine_tuple_size<S>()>());
+}
+
+// decorate {{{1
+// decorate(a)[i] reads or writes entry i of a as a Scalar object.
+template <class A> class scalar_reference
+{
+    A &a;
+    const size_t i;
+
+public:
+    using scalar_type = typename std::remove_const_t<A>::scalar_type;
+
+    Vc_INTRINSIC scalar_reference(A &aa, size_t ii) : a(aa), i(ii) {}
+    scalar_reference(const scalar_reference &) = delete;
+    scalar_reference &operator=(const scalar_reference &) = delete;
+
+    Vc_INTRINSIC void operator=(const scalar_type &x) && { assign(a, i, x); }
+    Vc_INTRINSIC operator scalar_type() const { return extract(a, i); }
+};
+
+template <class A> class decorated
+{
+    A &a;
+
+public:
+    Vc_INTRINSIC decorated(A &aa) : a(aa) {}
+    Vc_INTRINSIC scalar_reference<A> operator[](size_t i) { return {a, i}; }
+    Vc_INTRINSIC typename std::remove_const_t<A>::scalar_type operator[](size_t i) const
+    {
+        return extract(a, i);
+    }
+};
+
+template <class S, class B, size_t N>
+Vc_INTRINSIC decorated<adapter<S, B, N>> decorate(adapter<S, B, N> &a)
+{
+    return {a};
+}
+template <class S, class B, size_t N>
+Vc_INTRINSIC decorated<const adapter<S, B, N>> decorate(const adapter<S, B, N> &a)
+{
+    return {a};
+}
+
+// masked assignment {{{1
+// The mask of a where expression on an adapter is converted to the mask type of every
+// member via an array of bool.
+template <class T, class A>
+Vc_INTRINSIC void masked_member_assign(const bool *k, datapar<T, A> &lhs,
+                                       const datapar<T, A> &rhs)
+{
+    Vc::where(typename datapar<T, A>::mask_type(k, flags::element_aligned), lhs) = rhs;
+}
+template <class T, class A>
+Vc_INTRINSIC void masked_member_assign(const bool *k, mask<T, A> &lhs, const mask<T, A> &rhs)
+{
+    Vc::where(mask<T, A>(k, flags::element_aligned), lhs) = rhs;
+}
+template <class S, class B, size_t N>
+Vc_INTRINSIC void masked_member_assign(const bool *k, adapter<S, B, N> &lhs,
+                                       const adapter<S, B, N> &rhs)
+{
+    masked_member_assign_impl(k, lhs, rhs,
+                              std::make_index_sequence<determine_tuple_size<S>()>());
+}
+template <class S, class B, size_t N, size_t... I>
+Vc_INTRINSIC void masked_member_assign_impl(const bool *k, adapter<S, B, N> &lhs,
+                                            const adapter<S, B, N> &rhs,
+                                            std::index_sequence<I...>)
+{
+    unused(std::initializer_list<int>{
+        (masked_member_assign(k, get_dispatcher<I>(lhs), get_dispatcher<I>(rhs)), 0)...});
+}
+
+// adapter_where_expression {{{1
+template <class M, class A> class adapter_where_expression
+{
+    const M k;
+    A &a;
+    using S = typename A::scalar_type;
+
+public:
+    adapter_where_expression(const M &kk, A &aa) : k(kk), a(aa) {}
+    adapter_where_expression(const adapter_where_expression &) = delete;
+    adapter_where_expression(adapter_where_expression &&) = default;
+
+    Vc_INTRINSIC void operator=(const A &x) &&
+    {
+        bool mem[A::size()];
+        k.memstore(mem, flags::element_aligned);
+        masked_member_assign(mem, a, x);
+    }
+    Vc_INTRINSIC void operator=(const S &x) && { std::move(*this) = A(x); }
+
+    // loads / gathers only the entries selected by the mask
+    Vc_INTRINSIC void memload(const S *mem) &&
+    {
+        for (size_t i = 0; i < A::size(); ++i) {
+            if (k[i]) {
+                assign(a, i, mem[i]);
+            }
+        }
+    }
+    template <class I, class IA>
+    Vc_INTRINSIC void gather(const S *mem, const datapar<I, IA> &indexes) &&
+    {
+        for (size_t i = 0; i < A::size(); ++i) {
+            if (k[i]) {
+                assign(a, i, mem[indexes[i]]);
+            }
+        }
+    }
+};
+//}}}1
+}  // namespace detail
+
+// simdize {{{1
+// The vectorized type of T. Arithmetic members become datapar, bool members become
+// mask<MT>, and class templates get all their type arguments substituted, recursively.
+// N determines the number of entries; if N is 0, the first vectorized member uses its
+// native size. (non-std)
+template <class T, size_t N = 0, class MT = void>
+using simdize = typename detail::simdize_impl<T, N, MT>::type;
+
+using detail::assign;
+using detail::extract;
+using detail::decorate;
+
+// where {{{1
+// Masked assignment, load and gather for simdized objects. (non-std)
+template <class T, class A, class S, class B, size_t N>
+Vc_INTRINSIC detail::adapter_where_expression<mask<T, A>, detail::adapter<S, B, N>> where(
+    const mask<T, A> &k, detail::adapter<S, B, N> &a)
+{
+    static_assert(datapar_size_v<T, A> == N, "the mask must have as many entries as a");
+    return {k, a};
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+namespace std
+{
+template <class S, class B, size_t N>
+struct tuple_size<Vc::detail::adapter<S, B, N>>
+    : public integral_constant<size_t, Vc::detail::determine_tuple_size<S>()> {
+};
+template <size_t I, class S, class B, size_t N>
+struct tuple_element<I, Vc::detail::adapter<S, B, N>> {
+    using type = Vc::detail::member_type<I, B>;
+};
+}  // namespace std
+
+// Vc_SIMDIZE_INTERFACE {{{1
+// Use in the public section of a class template to make its members accessible to
+// simdize, e.g. Vc_SIMDIZE_INTERFACE((x, y, z)); (non-std)
+#define Vc_SIMDIZE_INTERFACE(MEMBERS_)                                                   \
+    template <std::size_t N_>                                                            \
+    inline auto vc_get_()->decltype(std::get<N_>(std::tie MEMBERS_))                     \
+    {                                                                                    \
+        return std::get<N_>(std::tie MEMBERS_);                                          \
+    }                                                                                    \
+    template <std::size_t N_>                                                            \
+    inline auto vc_get_() const->decltype(std::get<N_>(std::tie MEMBERS_))               \
+    {                                                                                    \
+        return std::get<N_>(std::tie MEMBERS_);                                          \
+    }                                                                                    \
+    enum : std::size_t {                                                                 \
+        tuple_size = std::tuple_size<decltype(std::make_tuple MEMBERS_)>::value          \
+    }
+//}}}1
+
+#endif  // VC_DATAPAR_SIMDIZE_H_
+
+// vim: foldmethod=marker
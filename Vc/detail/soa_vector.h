@@ -0,0 +1,318 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_DATAPAR_SOA_VECTOR_H_
+#define VC_DATAPAR_SOA_VECTOR_H_
+
+#include "simdize.h"
+#include "../Allocator"
+#include <algorithm>
+#include <cstring>
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// soa_reference {{{1
+// The class template of S instantiated with references for its arithmetic arguments, e.g.
+// Point<float &> for Point<float>. The members thus refer to the arrays of a soa_vector.
+template <class S> struct soa_reference_base;
+template <template <class...> class C, class... Ts> struct soa_reference_base<C<Ts...>> {
+    using type = C<std::conditional_t<std::is_arithmetic<Ts>::value, Ts &, Ts>...>;
+};
+
+template <class S> class soa_reference : public soa_reference_base<S>::type
+{
+    using Base = typename soa_reference_base<S>::type;
+    using index_seq = std::make_index_sequence<determine_tuple_size<S>()>;
+
+    template <class... Rs>
+    soa_reference(private_init_t, std::true_type, Rs &... refs) : Base(refs...)
+    {
+    }
+    template <class... Rs>
+    soa_reference(private_init_t, std::false_type, Rs &... refs) : Base{refs...}
+    {
+    }
+
+    template <size_t... I> void assign_impl(const S &rhs, std::index_sequence<I...>)
+    {
+        unused(std::initializer_list<int>{
+            (get_dispatcher<I>(static_cast<Base &>(*this)) = get_dispatcher<I>(rhs),
+             0)...});
+    }
+    template <size_t... I> S extract_impl(std::index_sequence<I...>) const
+    {
+        return S{get_dispatcher<I>(static_cast<const Base &>(*this))...};
+    }
+
+public:
+    using scalar_type = S;
+
+    template <class... Rs> static soa_reference make(Rs &... refs)
+    {
+        return {private_init, std::is_constructible<Base, Rs &...>(), refs...};
+    }
+
+    soa_reference(const soa_reference &) = default;
+
+    // assignments write through to the referenced entries
+    soa_reference &operator=(const S &rhs)
+    {
+        assign_impl(rhs, index_seq());
+        return *this;
+    }
+    soa_reference &operator=(const soa_reference &rhs) { return *this = S(rhs); }
+
+    operator S() const { return extract_impl(index_seq()); }
+};
+//}}}1
+}  // namespace detail
+
+// soa_vector {{{1
+// A growable container that stores every member of S in its own array. The arrays are
+// aligned and padded for the members of simdize<S, N>, thus load(i) and store(i, x) access
+// datapar_size() entries at once with aligned loads and stores. S must be a class template
+// whose members are arithmetic and accessible to simdize (i.e. a std::tuple or a class
+// using Vc_SIMDIZE_INTERFACE).
+//
+// Loop over the container in datapar-sized steps like this:
+//   for (size_t i = 0; i < v.size(); i += v.datapar_size()) {
+//       auto x = v.load(i);
+//       ...
+//       v.store(i, x);
+//   }
+// The last load and store may access entries past size(). They belong to the padding and
+// have unspecified values. (non-std)
+template <class S, size_t N = 0> class soa_vector
+{
+    using index_seq = std::make_index_sequence<detail::determine_tuple_size<S>()>;
+
+public:
+    using value_type = S;
+    using size_type = size_t;
+    using datapar_type = simdize<S, N>;
+    using reference = detail::soa_reference<S>;
+
+    static constexpr size_t datapar_size() { return datapar_type::size(); }
+
+private:
+    template <size_t I> using member_t = detail::member_type<I, S>;
+    template <size_t I>
+    using member_datapar = detail::member_type<I, typename datapar_type::base_type>;
+    // the arrays are allocated with Allocator<member_datapar<I>>
+    template <size_t I> using member_flags = flags::overaligned_tag<alignof(member_datapar<I>)>;
+
+    template <size_t... I>
+    static std::tuple<member_t<I> *...> arrays_type(std::index_sequence<I...>);
+    using arrays = decltype(arrays_type(index_seq()));
+
+    template <size_t... I>
+    static conjunction<std::is_arithmetic<member_t<I>>...> all_arithmetic(
+        std::index_sequence<I...>);
+    static_assert(detail::simdize_size<datapar_type>::value > 0 &&
+                      decltype(all_arithmetic(index_seq()))::value,
+                  "soa_vector requires a simdizable type with arithmetic members");
+
+public:
+    soa_vector() = default;
+    explicit soa_vector(size_t n, const S &x = S()) { resize(n, x); }
+    soa_vector(const soa_vector &rhs)
+    {
+        reserve(rhs.m_size);
+        m_size = rhs.m_size;
+        copy_from(rhs, index_seq());
+    }
+    soa_vector(soa_vector &&rhs) noexcept { swap(rhs); }
+    soa_vector &operator=(soa_vector rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+    ~soa_vector() { deallocate(m_data, m_capacity, index_seq()); }
+
+    void swap(soa_vector &rhs) noexcept
+    {
+        std::swap(m_data, rhs.m_data);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_capacity, rhs.m_capacity);
+    }
+
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_size == 0; }
+
+    // the array of member I
+    template <size_t I> member_t<I> *data() { return std::get<I>(m_data); }
+    template <size_t I> const member_t<I> *data() const { return std::get<I>(m_data); }
+
+    // Makes room for n entries, rounded up to a multiple of datapar_size().
+    void reserve(size_t n)
+    {
+        if (n > m_capacity) {
+            reallocate((n + datapar_size() - 1) / datapar_size() * datapar_size());
+        }
+    }
+
+    void resize(size_t n, const S &x = S())
+    {
+        if (n > m_capacity) {
+            reserve(std::max(n, 2 * m_capacity));
+        }
+        for (size_t i = m_size; i < n; ++i) {
+            set(i, x, index_seq());
+        }
+        m_size = n;
+    }
+
+    void clear() { m_size = 0; }
+
+    void push_back(const S &x)
+    {
+        if (m_size == m_capacity) {
+            reserve(std::max(datapar_size(), 2 * m_capacity));
+        }
+        set(m_size, x, index_seq());
+        ++m_size;
+    }
+
+    void pop_back() { --m_size; }
+
+    // Element access via a proxy object that refers to the members of entry i. The proxy
+    // derives from S's class template instantiated with references (e.g. Point<float &>);
+    // member functions that need the value types work on the S it converts to.
+    reference operator[](size_t i) { return make_reference(i, index_seq()); }
+    S operator[](size_t i) const { return get(i, index_seq()); }
+
+    // Returns the entries [i, i + datapar_size()). i must be a multiple of datapar_size()
+    // and less than size().
+    datapar_type load(size_t i) const
+    {
+        datapar_type x;
+        load_impl(x, i, index_seq());
+        return x;
+    }
+
+    // Sets the entries [i, i + datapar_size()) to x. i must be a multiple of
+    // datapar_size() and less than size().
+    void store(size_t i, const datapar_type &x) { store_impl(x, i, index_seq()); }
+
+private:
+    template <size_t I> static member_t<I> *allocate_member(size_t capacity)
+    {
+        return reinterpret_cast<member_t<I> *>(
+            Allocator<member_datapar<I>>().allocate(capacity / datapar_size()));
+    }
+    template <size_t I> static void deallocate_member(member_t<I> *p, size_t capacity)
+    {
+        if (p) {
+            Allocator<member_datapar<I>>().deallocate(
+                reinterpret_cast<member_datapar<I> *>(p), capacity / datapar_size());
+        }
+    }
+    template <size_t... I>
+    static void deallocate(arrays &a, size_t capacity, std::index_sequence<I...>)
+    {
+        detail::unused(std::initializer_list<int>{
+            (deallocate_member<I>(std::get<I>(a), capacity), 0)...});
+    }
+
+    // copies the entries [0, m_size) of src and value-initializes the rest, thus loads
+    // from the padding never read uninitialized memory
+    template <size_t I> void fill_member(arrays &dst, const arrays &src, size_t capacity)
+    {
+        member_t<I> *const p = std::get<I>(dst);
+        if (m_size > 0) {
+            std::memcpy(p, std::get<I>(src), m_size * sizeof(member_t<I>));
+        }
+        std::fill(p + m_size, p + capacity, member_t<I>());
+    }
+
+    void reallocate(size_t capacity) { reallocate(capacity, index_seq()); }
+    template <size_t... I> void reallocate(size_t capacity, std::index_sequence<I...>)
+    {
+        arrays fresh{};
+        try {
+            detail::unused(std::initializer_list<int>{
+                (std::get<I>(fresh) = allocate_member<I>(capacity), 0)...});
+        } catch (...) {
+            deallocate(fresh, capacity, index_seq());
+            throw;
+        }
+        detail::unused(std::initializer_list<int>{
+            (fill_member<I>(fresh, m_data, capacity), 0)...});
+        deallocate(m_data, m_capacity, index_seq());
+        m_data = fresh;
+        m_capacity = capacity;
+    }
+
+    template <size_t... I> void copy_from(const soa_vector &rhs, std::index_sequence<I...>)
+    {
+        detail::unused(std::initializer_list<int>{
+            (fill_member<I>(m_data, rhs.m_data, m_capacity), 0)...});
+    }
+
+    template <size_t... I> void set(size_t i, const S &x, std::index_sequence<I...>)
+    {
+        detail::unused(std::initializer_list<int>{
+            (std::get<I>(m_data)[i] = detail::get_dispatcher<I>(x), 0)...});
+    }
+    template <size_t... I> S get(size_t i, std::index_sequence<I...>) const
+    {
+        return S{std::get<I>(m_data)[i]...};
+    }
+    template <size_t... I> reference make_reference(size_t i, std::index_sequence<I...>)
+    {
+        return reference::make(std::get<I>(m_data)[i]...);
+    }
+
+    template <size_t... I>
+    void load_impl(datapar_type &x, size_t i, std::index_sequence<I...>) const
+    {
+        detail::unused(std::initializer_list<int>{
+            (detail::get_dispatcher<I>(x) =
+                 member_datapar<I>(std::get<I>(m_data) + i, member_flags<I>()),
+             0)...});
+    }
+    template <size_t... I>
+    void store_impl(const datapar_type &x, size_t i, std::index_sequence<I...>)
+    {
+        detail::unused(std::initializer_list<int>{
+            (detail::get_dispatcher<I>(x).memstore(std::get<I>(m_data) + i, member_flags<I>()),
+             0)...});
+    }
+
+    arrays m_data{};
+    size_t m_size = 0;
+    size_t m_capacity = 0;
+};
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_SOA_VECTOR_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,207 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_SORT_H_
+#define VC_DATAPAR_SORT_H_
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include "synopsis.h"
+#include "permute.h"
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+// sort_network {{{1
+// Bitonic sorting network in the variant where every comparator stores the minimum to the
+// lower index. For blocks of K = 2, 4, 8, ... entries, step J = K - 1 compares entry i with
+// its mirror i ^ (K - 1) in the block, and the steps J = K / 4, ..., 1 compare i with
+// i ^ J. Since no comparator moves a larger value downwards, sizes other than a power of
+// two behave as if padded with +inf: comparators with an entry >= N are skipped.
+constexpr int sort_partner(int i, int j, int n) { return (i ^ j) < n ? i ^ j : i; }
+
+constexpr int sort_next_k(int k, int j)
+{
+    return (j == k - 1 ? k / 4 : j / 2) == 0 ? 2 * k : k;
+}
+
+constexpr int sort_next_j(int k, int j)
+{
+    return (j == k - 1 ? k / 4 : j / 2) == 0 ? 2 * k - 1 : (j == k - 1 ? k / 4 : j / 2);
+}
+
+template <int K, int J, class T, class A, size_t... I>
+Vc_INTRINSIC datapar<T, A> sort_step(const datapar<T, A> &x, std::index_sequence<I...>)
+{
+    using V = datapar<T, A>;
+    constexpr int N = sizeof...(I);
+    const V y = permute<sort_partner(I, J, N)...>(x);
+    // min and max return the same argument for equal (or unordered) inputs, thus both
+    // entries of a comparator either keep or exchange their values
+    V r = min(x, y);
+    where(V([](auto i) { return T(sort_partner(i, J, N) < int(i)); }) != V(), r) = max(x, y);
+    return r;
+}
+
+// Applies the steps from (K, J) on, for N entries.
+template <int N, int K, int J, bool = (K < 2 * N)> struct sort_network {
+    template <class V> static Vc_INTRINSIC V apply(const V &x)
+    {
+        return sort_network<N, sort_next_k(K, J), sort_next_j(K, J)>::apply(
+            sort_step<K, J>(x, std::make_index_sequence<N>()));
+    }
+};
+template <int N, int K, int J> struct sort_network<N, K, J, false> {
+    template <class V> static Vc_INTRINSIC V apply(const V &x) { return x; }
+};
+
+// merge_sorted {{{1
+// Merges the sorted a and b, such that a receives the lower and b the upper half of all
+// entries, both sorted. N must be a power of two larger than 1.
+template <class T, class A, size_t... I>
+Vc_INTRINSIC void merge_sorted(datapar<T, A> &a, datapar<T, A> &b, std::index_sequence<I...>)
+{
+    constexpr int N = sizeof...(I);
+    static_assert(N > 1 && (N & (N - 1)) == 0, "");
+    // the mirror step of the block of 2N entries leaves two bitonic halves
+    const datapar<T, A> r = permute<(N - 1 - int(I))...>(b);
+    const datapar<T, A> lo = min(a, r);
+    b = sort_network<N, N, N / 2>::apply(max(a, r));
+    a = sort_network<N, N, N / 2>::apply(lo);
+}
+
+// merge_runs {{{1
+// Merges the sorted runs [a, a + na) and [b, b + nb) to out. na and nb are multiples of
+// V::size() and na is not zero.
+template <class V, class T>
+void merge_runs(const T *a, size_t na, const T *b, size_t nb, T *out)
+{
+    if (nb == 0) {
+        std::copy(a, a + na, out);
+        return;
+    }
+    constexpr size_t N = V::size();
+    const T *const a_end = a + na;
+    const T *const b_end = b + nb;
+    V lo(a, flags::element_aligned);
+    V hi(b, flags::element_aligned);
+    a += N;
+    b += N;
+    for (;;) {
+        merge_sorted(lo, hi, std::make_index_sequence<N>());
+        lo.memstore(out, flags::element_aligned);
+        out += N;
+        // the next vector comes from the run with the smaller head; all entries of hi are
+        // less or equal than the entries remaining in the run it came from
+        if (a != a_end && (b == b_end || *a < *b)) {
+            lo.memload(a, flags::element_aligned);
+            a += N;
+        } else if (b != b_end) {
+            lo.memload(b, flags::element_aligned);
+            b += N;
+        } else {
+            break;
+        }
+    }
+    hi.memstore(out, flags::element_aligned);
+}
+
+// sort_impl {{{1
+template <class T> void sort_impl(T *first, size_t n, std::true_type)
+{
+    std::sort(first, first + n);
+}
+
+template <class T> void sort_impl(T *first, size_t n, std::false_type)
+{
+    using V = native_datapar<T>;
+    constexpr size_t N = V::size();
+    if (n < 2 * N) {
+        std::sort(first, first + n);
+        return;
+    }
+    const size_t nv = n / N * N;
+
+    // runs of one vector
+    for (size_t i = 0; i < nv; i += N) {
+        sorted(V(first + i, flags::element_aligned)).memstore(first + i, flags::element_aligned);
+    }
+
+    // bottom-up merge passes, alternating between first and the buffer
+    std::unique_ptr<T[]> buffer(new T[nv]);
+    T *src = first;
+    T *dst = buffer.get();
+    for (size_t width = N; width < nv; width *= 2) {
+        for (size_t i = 0; i < nv; i += 2 * width) {
+            const size_t mid = std::min(i + width, nv);
+            const size_t end = std::min(i + 2 * width, nv);
+            merge_runs<V>(src + i, mid - i, src + mid, end - mid, dst + i);
+        }
+        std::swap(src, dst);
+    }
+    if (src != first) {
+        std::copy(src, src + nv, first);
+    }
+
+    // the remaining entries do not fill a vector
+    std::sort(first + nv, first + n);
+    std::inplace_merge(first, first + nv, first + n);
+}
+//}}}1
+}  // namespace detail
+
+// sorted {{{1
+// Returns the entries of x in ascending order, using a sorting network of min, max, and
+// permute. (non-std)
+template <class T, class A> Vc_INTRINSIC datapar<T, A> sorted(const datapar<T, A> &x)
+{
+    return detail::sort_network<datapar_size_v<T, A>, 2, 1>::apply(x);
+}
+
+// sort {{{1
+// Sorts the contiguous range [first, last) of arithmetic values in ascending order. Runs of
+// one native_datapar are sorted in registers and then merged pairwise with bitonic merges
+// of two vectors. The order of equal values is unspecified. (non-std)
+template <class ContiguousIterator>
+enable_if<std::is_arithmetic<typename std::iterator_traits<ContiguousIterator>::value_type>::value,
+          void>
+sort(ContiguousIterator first, ContiguousIterator last)
+{
+    using T = typename std::iterator_traits<ContiguousIterator>::value_type;
+    if (first == last) {
+        return;
+    }
+    detail::sort_impl(std::addressof(*first), size_t(last - first),
+                      std::integral_constant<bool, (native_datapar<T>::size() == 1)>());
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_SORT_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,161 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DATAPAR_SPLIT_CONCAT_H_
+#define VC_DATAPAR_SPLIT_CONCAT_H_
+
+#include "synopsis.h"
+#include <array>
+#ifdef Vc_HAVE_AVX_ABI
+#include "x86/intrinsics.h"
+#endif
+
+Vc_VERSIONED_NAMESPACE_BEGIN
+namespace detail
+{
+constexpr size_t sum() { return 0; }
+template <class... Ts> constexpr size_t sum(size_t first, Ts... rest)
+{
+    return first + sum(rest...);
+}
+
+// split_impl {{{1
+// The generic case copies entries [K * V::size(), (K + 1) * V::size()) of x into piece K.
+template <class V, class T, class A, size_t... K>
+Vc_INTRINSIC std::array<V, sizeof...(K)> split_impl(V *, const datapar<T, A> &x,
+                                                    std::index_sequence<K...>)
+{
+    return {{V([&](auto i) -> T { return x[i + K * V::size()]; })...}};
+}
+
+#ifdef Vc_HAVE_AVX_ABI
+template <class T>
+Vc_INTRINSIC std::array<datapar<T, datapar_abi::sse>, 2> split_impl(
+    datapar<T, datapar_abi::sse> *, const datapar<T, datapar_abi::avx> &x,
+    std::index_sequence<0, 1>)
+{
+    using V = datapar<T, datapar_abi::sse>;
+    const auto v = data(x).v();
+    return {{V(x86::lo128(v)), V(x86::hi128(v))}};
+}
+#endif  // Vc_HAVE_AVX_ABI
+
+#ifdef Vc_HAVE_AVX512_ABI
+template <class T>
+Vc_INTRINSIC std::array<datapar<T, datapar_abi::avx>, 2> split_impl(
+    datapar<T, datapar_abi::avx> *, const datapar<T, datapar_abi::avx512> &x,
+    std::index_sequence<0, 1>)
+{
+    using V = datapar<T, datapar_abi::avx>;
+    const auto v = data(x).v();
+    return {{V(x86::lo256(v)), V(x86::hi256(v))}};
+}
+
+template <class T>
+Vc_INTRINSIC std::array<datapar<T, datapar_abi::sse>, 4> split_impl(
+    datapar<T, datapar_abi::sse> *, const datapar<T, datapar_abi::avx512> &x,
+    std::index_sequence<0, 1, 2, 3>)
+{
+    using V = datapar<T, datapar_abi::sse>;
+    const auto v = data(x).v();
+    return {{V(x86::lo128(v)), V(x86::extract128<1>(v)), V(x86::extract128<2>(v)),
+             V(x86::extract128<3>(v))}};
+}
+#endif  // Vc_HAVE_AVX512_ABI
+
+// concat_impl {{{1
+// The generic case stores all arguments consecutively and loads the result from there.
+template <class R, class T, class... As>
+Vc_INTRINSIC R concat_impl(R *, const datapar<T, As> &... xs)
+{
+    alignas(memory_alignment<R>::value) T mem[R::size()];
+    size_t offset = 0;
+    unused(std::initializer_list<size_t>{
+        (xs.memstore(&mem[offset], flags::element_aligned), offset += xs.size())...});
+    return R(mem, flags::vector_aligned);
+}
+
+#ifdef Vc_HAVE_AVX_ABI
+template <class T>
+Vc_INTRINSIC datapar<T, datapar_abi::avx> concat_impl(datapar<T, datapar_abi::avx> *,
+                                                      const datapar<T, datapar_abi::sse> &a,
+                                                      const datapar<T, datapar_abi::sse> &b)
+{
+    return datapar<T, datapar_abi::avx>(x86::concat(data(a).v(), data(b).v()));
+}
+#endif  // Vc_HAVE_AVX_ABI
+
+#ifdef Vc_HAVE_AVX512_ABI
+template <class T>
+Vc_INTRINSIC datapar<T, datapar_abi::avx512> concat_impl(
+    datapar<T, datapar_abi::avx512> *, const datapar<T, datapar_abi::avx> &a,
+    const datapar<T, datapar_abi::avx> &b)
+{
+    return datapar<T, datapar_abi::avx512>(x86::concat(data(a).v(), data(b).v()));
+}
+
+template <class T>
+Vc_INTRINSIC datapar<T, datapar_abi::avx512> concat_impl(
+    datapar<T, datapar_abi::avx512> *, const datapar<T, datapar_abi::sse> &a,
+    const datapar<T, datapar_abi::sse> &b, const datapar<T, datapar_abi::sse> &c,
+    const datapar<T, datapar_abi::sse> &d)
+{
+    return datapar<T, datapar_abi::avx512>(
+        x86::concat(x86::concat(data(a).v(), data(b).v()),
+                    x86::concat(data(c).v(), data(d).v())));
+}
+#endif  // Vc_HAVE_AVX512_ABI
+//}}}1
+}  // namespace detail
+
+// split {{{1
+// Returns x split into datapar objects of type V, in order of increasing entry index.
+template <class V, class A>
+Vc_INTRINSIC enable_if<
+    is_datapar_v<V> && datapar_size_v<typename V::value_type, A> % V::size() == 0,
+    std::array<V, datapar_size_v<typename V::value_type, A> / V::size()>>
+split(const datapar<typename V::value_type, A> &x)
+{
+    constexpr size_t N = datapar_size_v<typename V::value_type, A> / V::size();
+    return detail::split_impl(static_cast<V *>(nullptr), x, std::make_index_sequence<N>());
+}
+
+// concat {{{1
+// Returns a datapar object with the entries of all arguments, in the order of the arguments.
+template <class T, class... As>
+Vc_INTRINSIC datapar<T, abi_for_size_t<T, detail::sum(datapar_size_v<T, As>...)>> concat(
+    const datapar<T, As> &... xs)
+{
+    using R = datapar<T, abi_for_size_t<T, detail::sum(datapar_size_v<T, As>...)>>;
+    return detail::concat_impl(static_cast<R *>(nullptr), xs...);
+}
+//}}}1
+Vc_VERSIONED_NAMESPACE_END
+
+#endif  // VC_DATAPAR_SPLIT_CONCAT_H_
+
+// vim: foldmethod=marker
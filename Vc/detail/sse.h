@@ -131,6 +131,44 @@ struct sse_datapar_impl : public generic_datapar_impl<sse_datapar_impl> {
         return detail::load16(mem, f);
     }
 
+    // non-temporal load without conversion{{{3
+#ifdef Vc_HAVE_SSE2
+    template <class T>
+    static Vc_INTRINSIC intrinsic_type<T> stream_load(const T *mem, type_tag<T>) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(stream_load16(mem));
+    }
+#endif  // Vc_HAVE_SSE2
+
+    // convert from half / bfloat16 {{{3
+    template <class T, class F>
+    static Vc_INTRINSIC intrinsic_type<T> load(const half *mem, F f, type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "half only converts to float");
+#ifdef Vc_HAVE_SSE2
+        return x86::half_to_float(size_constant<4>(),
+                                  load8(reinterpret_cast<const ushort *>(mem), f));
+#else
+        unused(f);
+        return generate_from_n_evaluations<size<T>(), intrinsic_type<T>>(
+            [&](auto i) { return static_cast<T>(mem[i]); });
+#endif
+    }
+    template <class T, class F>
+    static Vc_INTRINSIC intrinsic_type<T> load(const bfloat16 *mem, F f,
+                                               type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "bfloat16 only converts to float");
+#ifdef Vc_HAVE_SSE2
+        return x86::bfloat16_to_float(size_constant<4>(),
+                                      load8(reinterpret_cast<const ushort *>(mem), f));
+#else
+        unused(f);
+        return generate_from_n_evaluations<size<T>(), intrinsic_type<T>>(
+            [&](auto i) { return static_cast<T>(mem[i]); });
+#endif
+    }
+
     // convert from an SSE load{{{3
     template <class T, class U, class F>
     static Vc_INTRINSIC intrinsic_type<T> load(
@@ -279,7 +317,6 @@ struct sse_datapar_impl : public generic_datapar_impl<sse_datapar_impl> {
     static Vc_INTRINSIC void Vc_VDECL masked_load(datapar<T> &merge, mask<T> k,
                                                   const U *mem, F) noexcept
     {
-        // TODO: implement with V(P)MASKMOV if AVX(2) is available
         execute_n_times<size<T>()>([&](auto i) {
             if (k.d.m(i)) {
                 merge.d.set(i, static_cast<T>(mem[i]));
@@ -287,19 +324,80 @@ struct sse_datapar_impl : public generic_datapar_impl<sse_datapar_impl> {
         });
     }
 #ifdef Vc_HAVE_AVX
-    template <class F>
-    static Vc_INTRINSIC void Vc_VDECL masked_load(datapar<double> &merge, mask<double> k,
-                                                  const double *mem, F) noexcept
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL masked_load(
+        datapar<T> &merge, mask<T> k, const T *mem, F,
+        enable_if<(sizeof(T) >= maskload_min_entry_size<16>)> = nullarg) noexcept
     {
-        merge.d = _mm_blendv_pd(merge.d, _mm_maskload_pd(mem, _mm_castpd_si128(data(k))), data(k));
+        merge.d = maskload16(merge.d.v(), k.d.v(), mem);
     }
-    template <class F>
-    static Vc_INTRINSIC void Vc_VDECL masked_load(datapar<float> &merge, mask<float> k,
-                                                  const float *mem, F) noexcept
+#endif  // Vc_HAVE_AVX
+
+    // gather {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC datapar_member_type<T> gather(const U *mem,
+                                                      const Vc::datapar<I, IA> &idx,
+                                                      type_tag<T>) noexcept
     {
-        merge.d = _mm_blendv_ps(merge.d, _mm_maskload_ps(mem, _mm_castps_si128(data(k))), data(k));
+        return generate_from_n_evaluations<size<T>(), datapar_member_type<T>>(
+            [&](auto i) { return static_cast<T>(mem[idx[i]]); });
     }
-#endif  // Vc_HAVE_AVX
+#ifdef Vc_HAVE_AVX2
+    // 32-bit entries with 32-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(
+            _mm_i32gather_epi32(reinterpret_cast<const int *>(mem), data(idx), 4));
+    }
+
+    // 64-bit entries with 64-bit indexes{{{3
+    template <class T, class I>
+    static Vc_INTRINSIC intrinsic_type<T> gather(
+        const T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        return intrin_cast<intrinsic_type<T>>(
+            _mm_i64gather_epi64(reinterpret_cast<const llong *>(mem), data(idx), 8));
+    }
+#endif  // Vc_HAVE_AVX2
+
+    // masked gather {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(datapar<T> &merge, mask<T> k,
+                                                    const U *mem,
+                                                    const Vc::datapar<I, IA> &idx) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) {
+            if (k.d.m(i)) {
+                merge.d.set(i, static_cast<T>(mem[idx[i]]));
+            }
+        });
+    }
+#ifdef Vc_HAVE_AVX2
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem, const Vc::datapar<I, abi> &idx,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm_mask_i32gather_epi32(
+            intrin_cast<__m128i>(merge.d.v()), reinterpret_cast<const int *>(mem),
+            data(idx), intrin_cast<__m128i>(k.d.v()), 4));
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_gather(
+        datapar<T> &merge, mask<T> k, const T *mem, const Vc::datapar<I, abi> &idx,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        merge.d = intrin_cast<intrinsic_type<T>>(_mm_mask_i64gather_epi64(
+            intrin_cast<__m128i>(merge.d.v()), reinterpret_cast<const llong *>(mem),
+            data(idx), intrin_cast<__m128i>(k.d.v()), 8));
+    }
+#endif  // Vc_HAVE_AVX2
 
     // store {{{2
     // store to long double has no vector implementation{{{3
@@ -319,6 +417,44 @@ struct sse_datapar_impl : public generic_datapar_impl<sse_datapar_impl> {
         store16(v, mem, f);
     }
 
+    // non-temporal store without conversion{{{3
+#ifdef Vc_HAVE_SSE2
+    template <class T>
+    static Vc_INTRINSIC void Vc_VDECL stream_store(datapar_member_type<T> v, T *mem,
+                                                   type_tag<T>) noexcept
+    {
+        stream_store16(v, mem);
+    }
+#endif  // Vc_HAVE_SSE2
+
+    // convert to half / bfloat16 {{{3
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL store(datapar_member_type<T> v, half *mem, F f,
+                                            type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "half only converts from float");
+#ifdef Vc_HAVE_SSE2
+        store8(x86::float_to_half(size_constant<4>(), v), reinterpret_cast<ushort *>(mem),
+               f);
+#else
+        unused(f);
+        execute_n_times<size<T>()>([&](auto i) { mem[i] = static_cast<half>(v[i]); });
+#endif
+    }
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL store(datapar_member_type<T> v, bfloat16 *mem, F f,
+                                            type_tag<T>) noexcept
+    {
+        static_assert(std::is_same<T, float>::value, "bfloat16 only converts from float");
+#ifdef Vc_HAVE_SSE2
+        store8(x86::float_to_bfloat16(size_constant<4>(), v),
+               reinterpret_cast<ushort *>(mem), f);
+#else
+        unused(f);
+        execute_n_times<size<T>()>([&](auto i) { mem[i] = static_cast<bfloat16>(v[i]); });
+#endif
+    }
+
     // convert and 16-bit store{{{3
     template <class T, class U, class F>
     static Vc_INTRINSIC void Vc_VDECL
@@ -457,13 +593,79 @@ struct sse_datapar_impl : public generic_datapar_impl<sse_datapar_impl> {
     static Vc_INTRINSIC void Vc_VDECL masked_store(datapar<T> v, U *mem, F,
                                                    mask<T> k) noexcept
     {
-        //TODO: detail::masked_store(mem, v.v(), k.d.v(), f);
         execute_n_times<size<T>()>([&](auto i) {
             if (k.d.m(i)) {
                 mem[i] = static_cast<T>(v.d.m(i));
             }
         });
     }
+#ifdef Vc_HAVE_AVX
+    template <class T, class F>
+    static Vc_INTRINSIC void Vc_VDECL masked_store(
+        datapar<T> v, T *mem, F, mask<T> k,
+        enable_if<(sizeof(T) >= maskload_min_entry_size<16>)> = nullarg) noexcept
+    {
+        maskstore16(v.d.v(), k.d.v(), mem);
+    }
+#endif  // Vc_HAVE_AVX
+
+    // scatter {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void Vc_VDECL scatter(datapar_member_type<T> v, U *mem,
+                                              const Vc::datapar<I, IA> &idx,
+                                              type_tag<T>) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) { mem[idx[i]] = static_cast<U>(v.m(i)); });
+    }
+#ifdef Vc_HAVE_AVX512VL
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm_i32scatter_epi32(mem, data(idx), intrin_cast<__m128i>(v.v()), 4);
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL scatter(
+        datapar_member_type<T> v, T *mem, const Vc::datapar<I, abi> &idx, type_tag<T>,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        _mm_i64scatter_epi64(mem, data(idx), intrin_cast<__m128i>(v.v()), 8);
+    }
+#endif  // Vc_HAVE_AVX512VL
+
+    // masked scatter {{{2
+    template <class T, class U, class I, class IA>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(datapar<T> v, U *mem,
+                                                     const Vc::datapar<I, IA> &idx,
+                                                     mask<T> k) noexcept
+    {
+        execute_n_times<size<T>()>([&](auto i) {
+            if (k.d.m(i)) {
+                mem[idx[i]] = static_cast<U>(v.d.m(i));
+            }
+        });
+    }
+#ifdef Vc_HAVE_AVX512VL
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, abi> &idx, mask<T> k,
+        enable_if<sizeof(T) == 4 && sizeof(I) == 4 && std::is_signed<I>::value> =
+            nullarg) noexcept
+    {
+        _mm_mask_i32scatter_epi32(mem, _mm_movemask_ps(intrin_cast<__m128>(k.d.v())),
+                                  data(idx), intrin_cast<__m128i>(v.d.v()), 4);
+    }
+    template <class T, class I>
+    static Vc_INTRINSIC void Vc_VDECL masked_scatter(
+        datapar<T> v, T *mem, const Vc::datapar<I, abi> &idx, mask<T> k,
+        enable_if<sizeof(T) == 8 && sizeof(I) == 8> = nullarg) noexcept
+    {
+        _mm_mask_i64scatter_epi64(mem, _mm_movemask_pd(intrin_cast<__m128d>(k.d.v())),
+                                  data(idx), intrin_cast<__m128i>(v.d.v()), 8);
+    }
+#endif  // Vc_HAVE_AVX512VL
 
     // negation {{{2
     template <class T> static Vc_INTRINSIC mask<T> Vc_VDECL negate(datapar<T> x) noexcept
@@ -847,11 +1049,12 @@ struct sse_mask_impl {
     static Vc_INTRINSIC auto load(const bool *mem, F, size_tag<4>) noexcept
     {
 #ifdef Vc_HAVE_SSE2
-        __m128i k = _mm_cvtsi32_si128(*reinterpret_cast<const int *>(mem));
+        __m128i k = _mm_cvtsi32_si128(*reinterpret_cast<const may_alias<int> *>(mem));
         k = _mm_cmpgt_epi16(_mm_unpacklo_epi8(k, k), _mm_setzero_si128());
         return intrin_cast<__m128>(_mm_unpacklo_epi16(k, k));
 #elif defined Vc_HAVE_MMX
-        __m128 k = _mm_cvtpi8_ps(_mm_cvtsi32_si64(*reinterpret_cast<const int *>(mem)));
+        __m128 k = _mm_cvtpi8_ps(
+            _mm_cvtsi32_si64(*reinterpret_cast<const may_alias<int> *>(mem)));
         _mm_empty();
         return _mm_cmpgt_ps(k, detail::zero<__m128>());
 #endif  // Vc_HAVE_SSE2
@@ -866,7 +1069,7 @@ struct sse_mask_impl {
     static Vc_INTRINSIC auto load(const bool *mem, F, size_tag<8>) noexcept
     {
 #ifdef Vc_IS_AMD64
-        __m128i k = _mm_cvtsi64_si128(*reinterpret_cast<const int64_t *>(mem));
+        __m128i k = _mm_cvtsi64_si128(*reinterpret_cast<const may_alias<int64_t> *>(mem));
 #else
         __m128i k = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem));
 #endif
@@ -371,6 +371,24 @@ public:
         detail::get_impl_t<V>::masked_store(d, mem, f, k);
     }
 
+    template <class U, class I, class IA>
+    Vc_NODISCARD Vc_INTRINSIC V gather(const U *mem, const datapar<I, IA> &indexes) const &&
+    {
+        static_assert(std::is_integral<I>::value && datapar<I, IA>::size() == V::size(),
+                      "gathers require an integral index vector of equal size");
+        V r = d;
+        detail::get_impl_t<V>::masked_gather(r, k, mem, indexes);
+        return r;
+    }
+
+    template <class U, class I, class IA>
+    Vc_INTRINSIC void scatter(U *mem, const datapar<I, IA> &indexes) const &&
+    {
+        static_assert(std::is_integral<I>::value && datapar<I, IA>::size() == V::size(),
+                      "scatters require an integral index vector of equal size");
+        detail::get_impl_t<V>::masked_scatter(d, mem, indexes, k);
+    }
+
 protected:
     friend Vc_INTRINSIC const M &get_mask(const const_where_expression &x) { return x.k; }
     friend Vc_INTRINSIC T &get_lvalue(const_where_expression &x) { return x.d; }
@@ -476,6 +494,15 @@ public:
     {
         detail::get_impl_t<T>::masked_load(d, k, mem, f);
     }
+
+    // intentionally hides const_where_expression::gather
+    template <class U, class I, class IA>
+    Vc_INTRINSIC void gather(const U *mem, const datapar<I, IA> &indexes)
+    {
+        static_assert(std::is_integral<I>::value && datapar<I, IA>::size() == T::size(),
+                      "gathers require an integral index vector of equal size");
+        detail::get_impl_t<T>::masked_gather(d, k, mem, indexes);
+    }
 };
 
 template <class T, class A>
@@ -566,6 +593,37 @@ Vc_INTRINSIC datapar<T, Abi> abs(const datapar<T, Abi> &x)
     return detail::get_impl_t<datapar<T, Abi>>::abs(x);
 }
 
+// a * b + c with a single rounding
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, datapar<T, Abi>> fma(
+    const datapar<T, Abi> &a, const datapar<T, Abi> &b, const datapar<T, Abi> &c)
+{
+    return detail::get_impl_t<datapar<T, Abi>>::fma(a, b, c);
+}
+
+// x + y and x - y, clamped to the range of T instead of wrapping around (non-std)
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && (sizeof(T) <= 2), datapar<T, Abi>>
+add_sat(const datapar<T, Abi> &x, const datapar<T, Abi> &y)
+{
+    return detail::get_impl_t<datapar<T, Abi>>::add_sat(x, y);
+}
+
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && (sizeof(T) <= 2), datapar<T, Abi>>
+sub_sat(const datapar<T, Abi> &x, const datapar<T, Abi> &y)
+{
+    return detail::get_impl_t<datapar<T, Abi>>::sub_sat(x, y);
+}
+
+// (x + y + 1) >> 1, without overflow in the sum (non-std)
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && (sizeof(T) <= 2), datapar<T, Abi>>
+avg(const datapar<T, Abi> &x, const datapar<T, Abi> &y)
+{
+    return detail::get_impl_t<datapar<T, Abi>>::avg(x, y);
+}
+
 Vc_VERSIONED_NAMESPACE_END
 
 #endif  // VC_DATAPAR_SYNOPSIS_H_
@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_DATAPAR_X86_ARITHMETICS_H_
 #define VC_DATAPAR_X86_ARITHMETICS_H_
 
+#include <cmath>
 #include "storage.h"
 
 Vc_VERSIONED_NAMESPACE_BEGIN
@@ -133,29 +134,62 @@ Vc_INTRINSIC __m512i Vc_VDECL minus(z_u08 a, z_u08 b) { return _mm512_sub_epi8(a
 #endif  // Vc_HAVE_AVX512F
 #endif  // Vc_USE_BUILTIN_VECTOR_TYPES
 
-// multiplies{{{1
-#ifdef Vc_USE_BUILTIN_VECTOR_TYPES
-template <class T, size_t N> Vc_INTRINSIC auto Vc_VDECL multiplies(Storage<T, N> a, Storage<T, N> b)
+// mullo_epi64{{{1
+// The low 64 bits of the product. Used by multiplies and the 64-bit division below, thus
+// it is available independent of Vc_USE_BUILTIN_VECTOR_TYPES.
+Vc_INTRINSIC __m128i Vc_VDECL mullo_epi64(__m128i a, __m128i b)
 {
-    return a.builtin() * b.builtin();
-}
-#else   // Vc_USE_BUILTIN_VECTOR_TYPES
-Vc_INTRINSIC __m128  Vc_VDECL multiplies(x_f32 a, x_f32 b) { return _mm_mul_ps(a, b); }
-Vc_INTRINSIC __m128d Vc_VDECL multiplies(x_f64 a, x_f64 b) { return _mm_mul_pd(a, b); }
-Vc_INTRINSIC __m128i Vc_VDECL multiplies(x_i64 a, x_i64 b) {
 #if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512DQ
     return _mm_mullo_epi64(a, b);
 #else
-    return x_i64{a[0] * b[0], a[1] * b[1]};
+    const __m128i r0 = _mm_mul_epu32(a, b);
+    const __m128i r1 = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), 32);
+    const __m128i r2 = _mm_slli_epi64(_mm_mul_epu32(a, _mm_srli_epi64(b, 32)), 32);
+    return _mm_add_epi64(_mm_add_epi64(r0, r1), r2);
 #endif
 }
-Vc_INTRINSIC __m128i Vc_VDECL multiplies(x_u64 a, x_u64 b) {
+
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL mullo_epi64(__m256i a, __m256i b)
+{
 #if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512DQ
-    return _mm_mullo_epi64(a, b);
+    return _mm256_mullo_epi64(a, b);
 #else
-    return x_u64{a[0] * b[0], a[1] * b[1]};
+    const __m256i r0 = _mm256_mul_epu32(a, b);
+    const __m256i r1 = _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), 32);
+    const __m256i r2 = _mm256_slli_epi64(_mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)), 32);
+    return _mm256_add_epi64(_mm256_add_epi64(r0, r1), r2);
 #endif
 }
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512i Vc_VDECL mullo_epi64(__m512i a, __m512i b)
+{
+#ifdef Vc_HAVE_AVX512DQ
+    return _mm512_mullo_epi64(a, b);
+#else   // Vc_HAVE_AVX512DQ
+    const __m512i r0 = _mm512_mul_epu32(a, b);
+    const __m512i aShift = _mm512_srli_epi64(a, 32);
+    const __m512i bShift = _mm512_srli_epi64(b, 32);
+    const __m512i r1 = _mm512_slli_epi64(_mm512_mul_epu32(aShift, b), 32);
+    const __m512i r2 = _mm512_slli_epi64(_mm512_mul_epu32(a, bShift), 32);
+    return _mm512_add_epi64(_mm512_add_epi64(r0, r1), r2);
+#endif  // Vc_HAVE_AVX512DQ
+}
+#endif  // Vc_HAVE_AVX512F
+
+// multiplies{{{1
+#ifdef Vc_USE_BUILTIN_VECTOR_TYPES
+template <class T, size_t N> Vc_INTRINSIC auto Vc_VDECL multiplies(Storage<T, N> a, Storage<T, N> b)
+{
+    return a.builtin() * b.builtin();
+}
+#else   // Vc_USE_BUILTIN_VECTOR_TYPES
+Vc_INTRINSIC __m128  Vc_VDECL multiplies(x_f32 a, x_f32 b) { return _mm_mul_ps(a, b); }
+Vc_INTRINSIC __m128d Vc_VDECL multiplies(x_f64 a, x_f64 b) { return _mm_mul_pd(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL multiplies(x_i64 a, x_i64 b) { return mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL multiplies(x_u64 a, x_u64 b) { return mullo_epi64(a, b); }
 Vc_INTRINSIC __m128i Vc_VDECL multiplies(x_i32 a, x_i32 b) {
 #ifdef Vc_HAVE_SSE4_1
     return _mm_mullo_epi32(a, b);
@@ -182,13 +216,8 @@ Vc_INTRINSIC __m256  Vc_VDECL multiplies(y_f32 a, y_f32 b) { return _mm256_mul_p
 Vc_INTRINSIC __m256d Vc_VDECL multiplies(y_f64 a, y_f64 b) { return _mm256_mul_pd(a, b); }
 #endif  // Vc_HAVE_AVX
 #ifdef Vc_HAVE_AVX2
-#if defined Vc_HAVE_AVX512DQ && defined Vc_HAVE_AVX512VL
-Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_i64 a, y_i64 b) { return _mm256_mullo_epi64(a, b); }
-Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_u64 a, y_u64 b) { return _mm256_mullo_epi64(a, b); }
-#else
-Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_i64 a, y_i64 b) { return y_i64{a[0] * b[0], a[1] * b[1], a[2] * b[2], a[3] * b[3]}; }
-Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_u64 a, y_u64 b) { return y_u64{a[0] * b[0], a[1] * b[1], a[2] * b[2], a[3] * b[3]}; }
-#endif
+Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_i64 a, y_i64 b) { return mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_u64 a, y_u64 b) { return mullo_epi64(a, b); }
 Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_i32 a, y_i32 b) { return _mm256_mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_u32 a, y_u32 b) { return _mm256_mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_i16 a, y_i16 b) { return _mm256_mullo_epi16(a, b); }
@@ -204,19 +233,8 @@ Vc_INTRINSIC __m256i Vc_VDECL multiplies(y_u08 a, y_u08 b) { return multiplies(y
 #ifdef Vc_HAVE_AVX512F
 Vc_INTRINSIC __m512  Vc_VDECL multiplies(z_f32 a, z_f32 b) { return _mm512_mul_ps(a, b); }
 Vc_INTRINSIC __m512d Vc_VDECL multiplies(z_f64 a, z_f64 b) { return _mm512_mul_pd(a, b); }
-Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_i64 a, z_i64 b) {
-#ifdef Vc_HAVE_AVX512DQ
-    return _mm512_mullo_epi64(a, b);
-#else   // Vc_HAVE_AVX512DQ
-    const __m512i r0 = _mm512_mul_epu32(a, b);
-    const __m512i aShift = _mm512_srli_epi64(a, 32);
-    const __m512i bShift = _mm512_srli_epi64(b, 32);
-    const __m512i r1 = _mm512_slli_epi64(_mm512_mul_epu32(aShift, b), 32);
-    const __m512i r2 = _mm512_slli_epi64(_mm512_mul_epu32(a, bShift), 32);
-    return _mm512_add_epi64(_mm512_add_epi64(r0, r1), r2);
-#endif  // Vc_HAVE_AVX512DQ
-}
-Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_u64 a, z_u64 b) { return multiplies(z_i64(a),z_i64(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_i64 a, z_i64 b) { return mullo_epi64(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_u64 a, z_u64 b) { return mullo_epi64(a, b); }
 Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_i32 a, z_i32 b) { return _mm512_mullo_epi32(a, b); }
 Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_u32 a, z_u32 b) { return _mm512_mullo_epi32(a, b); }
 #ifdef Vc_HAVE_AVX512BW
@@ -232,6 +250,204 @@ Vc_INTRINSIC __m512i Vc_VDECL multiplies(z_u08 a, z_u08 b) { return multiplies(z
 #endif  // Vc_HAVE_AVX512F
 #endif  // Vc_USE_BUILTIN_VECTOR_TYPES
 
+// mulhi{{{1
+// The upper half of the double-width product. There is no builtin operator for it, thus
+// the intrinsics are used for all storage types.
+
+// generic scalar fallback
+template <class T, size_t N> Vc_INTRINSIC Storage<T, N> mulhi(Storage<T, N> a, Storage<T, N> b)
+{
+    static_assert(std::is_integral<T>::value, "mulhi is only supported for integral types");
+    return generate_from_n_evaluations<N, Storage<T, N>>(
+        [&](auto i) { return detail::mulhi(a[i], b[i]); });
+}
+
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_u64 a, x_u64 b)
+{
+    // schoolbook multiplication with 32-bit digits, see detail::mulhi(ullong, ullong)
+    const __m128i lo32 = _mm_srli_epi64(allone<__m128i>(), 32);
+    const __m128i a_hi = _mm_srli_epi64(a, 32);
+    const __m128i b_hi = _mm_srli_epi64(b, 32);
+    const __m128i lh = _mm_mul_epu32(a, b_hi);
+    const __m128i hl = _mm_mul_epu32(a_hi, b);
+    const __m128i mid = _mm_add_epi64(
+        _mm_add_epi64(_mm_srli_epi64(_mm_mul_epu32(a, b), 32), and_(lh, lo32)),
+        and_(hl, lo32));
+    return _mm_add_epi64(
+        _mm_add_epi64(_mm_mul_epu32(a_hi, b_hi), _mm_srli_epi64(lh, 32)),
+        _mm_add_epi64(_mm_srli_epi64(hl, 32), _mm_srli_epi64(mid, 32)));
+}
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_i64 a, x_i64 b)
+{
+#ifdef Vc_HAVE_SSE4_2
+    const __m128i a_sign = _mm_cmpgt_epi64(_mm_setzero_si128(), a);
+    const __m128i b_sign = _mm_cmpgt_epi64(_mm_setzero_si128(), b);
+#else
+    const __m128i a_sign = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), 0xf5);
+    const __m128i b_sign = _mm_shuffle_epi32(_mm_srai_epi32(b, 31), 0xf5);
+#endif
+    return _mm_sub_epi64(_mm_sub_epi64(mulhi(x_u64(a), x_u64(b)), and_(a_sign, b)),
+                         and_(b_sign, a));
+}
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_u32 a, x_u32 b)
+{
+    const __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+#ifdef Vc_HAVE_SSE4_1
+    return _mm_blend_epi16(even, odd, 0xcc);
+#else
+    return or_(even, _mm_slli_epi64(_mm_srli_epi64(odd, 32), 32));
+#endif
+}
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_i32 a, x_i32 b)
+{
+#ifdef Vc_HAVE_SSE4_1
+    const __m128i even = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+    const __m128i odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_blend_epi16(even, odd, 0xcc);
+#else
+    return _mm_sub_epi32(
+        _mm_sub_epi32(mulhi(x_u32(a), x_u32(b)), and_(_mm_srai_epi32(a, 31), b)),
+        and_(_mm_srai_epi32(b, 31), a));
+#endif
+}
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_i16 a, x_i16 b) { return _mm_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_u16 a, x_u16 b) { return _mm_mulhi_epu16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_i08 a, x_i08 b)
+{
+    // sign extension to 16 bits via unpack with itself and an arithmetic shift
+    const __m128i lo = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(a, a), 8),
+                                       _mm_srai_epi16(_mm_unpacklo_epi8(b, b), 8));
+    const __m128i hi = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(a, a), 8),
+                                       _mm_srai_epi16(_mm_unpackhi_epi8(b, b), 8));
+    return _mm_packs_epi16(_mm_srai_epi16(lo, 8), _mm_srai_epi16(hi, 8));
+}
+Vc_INTRINSIC __m128i Vc_VDECL mulhi(x_u08 a, x_u08 b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo =
+        _mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    const __m128i hi =
+        _mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_u64 a, y_u64 b)
+{
+    const __m256i lo32 = _mm256_srli_epi64(allone<__m256i>(), 32);
+    const __m256i a_hi = _mm256_srli_epi64(a, 32);
+    const __m256i b_hi = _mm256_srli_epi64(b, 32);
+    const __m256i lh = _mm256_mul_epu32(a, b_hi);
+    const __m256i hl = _mm256_mul_epu32(a_hi, b);
+    const __m256i mid = _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_srli_epi64(_mm256_mul_epu32(a, b), 32), and_(lh, lo32)),
+        and_(hl, lo32));
+    return _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_mul_epu32(a_hi, b_hi), _mm256_srli_epi64(lh, 32)),
+        _mm256_add_epi64(_mm256_srli_epi64(hl, 32), _mm256_srli_epi64(mid, 32)));
+}
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_i64 a, y_i64 b)
+{
+    const __m256i a_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    const __m256i b_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), b);
+    return _mm256_sub_epi64(
+        _mm256_sub_epi64(mulhi(y_u64(a), y_u64(b)), and_(a_sign, b)), and_(b_sign, a));
+}
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_u32 a, y_u32 b)
+{
+    const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, odd, 0xaa);
+}
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_i32 a, y_i32 b)
+{
+    const __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, odd, 0xaa);
+}
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_i16 a, y_i16 b) { return _mm256_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_u16 a, y_u16 b) { return _mm256_mulhi_epu16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_i08 a, y_i08 b)
+{
+    // unpack and pack both work per 128-bit lane, thus the element order is retained
+    const __m256i lo =
+        _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpacklo_epi8(a, a), 8),
+                           _mm256_srai_epi16(_mm256_unpacklo_epi8(b, b), 8));
+    const __m256i hi =
+        _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpackhi_epi8(a, a), 8),
+                           _mm256_srai_epi16(_mm256_unpackhi_epi8(b, b), 8));
+    return _mm256_packs_epi16(_mm256_srai_epi16(lo, 8), _mm256_srai_epi16(hi, 8));
+}
+Vc_INTRINSIC __m256i Vc_VDECL mulhi(y_u08 a, y_u08 b)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lo =
+        _mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+    const __m256i hi =
+        _mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+    return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_u64 a, z_u64 b)
+{
+    const __m512i lo32 = _mm512_srli_epi64(allone<__m512i>(), 32);
+    const __m512i a_hi = _mm512_srli_epi64(a, 32);
+    const __m512i b_hi = _mm512_srli_epi64(b, 32);
+    const __m512i lh = _mm512_mul_epu32(a, b_hi);
+    const __m512i hl = _mm512_mul_epu32(a_hi, b);
+    const __m512i mid = _mm512_add_epi64(
+        _mm512_add_epi64(_mm512_srli_epi64(_mm512_mul_epu32(a, b), 32), and_(lh, lo32)),
+        and_(hl, lo32));
+    return _mm512_add_epi64(
+        _mm512_add_epi64(_mm512_mul_epu32(a_hi, b_hi), _mm512_srli_epi64(lh, 32)),
+        _mm512_add_epi64(_mm512_srli_epi64(hl, 32), _mm512_srli_epi64(mid, 32)));
+}
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_i64 a, z_i64 b)
+{
+    return _mm512_sub_epi64(
+        _mm512_sub_epi64(mulhi(z_u64(a), z_u64(b)), and_(_mm512_srai_epi64(a, 63), b)),
+        and_(_mm512_srai_epi64(b, 63), a));
+}
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_u32 a, z_u32 b)
+{
+    const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+    const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_i32 a, z_i32 b)
+{
+    const __m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+    const __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_i16 a, z_i16 b) { return _mm512_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_u16 a, z_u16 b) { return _mm512_mulhi_epu16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_i08 a, z_i08 b)
+{
+    const __m512i lo =
+        _mm512_mullo_epi16(_mm512_srai_epi16(_mm512_unpacklo_epi8(a, a), 8),
+                           _mm512_srai_epi16(_mm512_unpacklo_epi8(b, b), 8));
+    const __m512i hi =
+        _mm512_mullo_epi16(_mm512_srai_epi16(_mm512_unpackhi_epi8(a, a), 8),
+                           _mm512_srai_epi16(_mm512_unpackhi_epi8(b, b), 8));
+    return _mm512_packs_epi16(_mm512_srai_epi16(lo, 8), _mm512_srai_epi16(hi, 8));
+}
+Vc_INTRINSIC __m512i Vc_VDECL mulhi(z_u08 a, z_u08 b)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i lo =
+        _mm512_mullo_epi16(_mm512_unpacklo_epi8(a, zero), _mm512_unpacklo_epi8(b, zero));
+    const __m512i hi =
+        _mm512_mullo_epi16(_mm512_unpackhi_epi8(a, zero), _mm512_unpackhi_epi8(b, zero));
+    return _mm512_packus_epi16(_mm512_srli_epi16(lo, 8), _mm512_srli_epi16(hi, 8));
+}
+#endif  // Vc_HAVE_AVX512BW
+#endif  // Vc_HAVE_AVX512F
+
 // divides{{{1
 #ifdef Vc_USE_BUILTIN_VECTOR_TYPES
 // builtin{{{2
@@ -245,10 +461,6 @@ Vc_INTRINSIC x_f32 Vc_VDECL divides(x_f32 a, x_f32 b) { return _mm_div_ps(a, b);
 
 Vc_INTRINSIC x_f64 Vc_VDECL divides(x_f64 a, x_f64 b) { return _mm_div_pd(a, b); }
 
-Vc_INTRINSIC x_i64 Vc_VDECL divides(x_i64 a, x_i64 b) { return {a[0] / b[0], a[1] / b[1]}; }
-
-Vc_INTRINSIC x_u64 Vc_VDECL divides(x_u64 a, x_u64 b) { return {a[0] / b[0], a[1] / b[1]}; }
-
 Vc_INTRINSIC x_i32 Vc_VDECL divides(x_i32 a, x_i32 b) {
 #ifdef Vc_HAVE_AVX
     return _mm256_cvttpd_epi32(
@@ -355,8 +567,6 @@ Vc_INTRINSIC y_f32 Vc_VDECL divides(y_f32 a, y_f32 b) { return _mm256_div_ps(a,
 Vc_INTRINSIC y_f64 Vc_VDECL divides(y_f64 a, y_f64 b) { return _mm256_div_pd(a, b); }
 #endif// Vc_HAVE_AVX
 #ifdef Vc_HAVE_AVX2
-Vc_INTRINSIC y_i64 Vc_VDECL divides(y_i64 a, y_i64 b) { return {a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3]}; }
-Vc_INTRINSIC y_u64 Vc_VDECL divides(y_u64 a, y_u64 b) { return {a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3]}; }
 Vc_INTRINSIC y_i32 Vc_VDECL divides(y_i32 a, y_i32 b) {
 #ifdef Vc_HAVE_AVX512F
     return _mm512_cvttpd_epi32(
@@ -437,14 +647,6 @@ Vc_INTRINSIC y_u08 Vc_VDECL divides(y_u08 a, y_u08 b) {
 #ifdef Vc_HAVE_AVX512F
 Vc_INTRINSIC z_f32 Vc_VDECL divides(z_f32 a, z_f32 b) { return _mm512_div_ps(a, b); }
 Vc_INTRINSIC z_f64 Vc_VDECL divides(z_f64 a, z_f64 b) { return _mm512_div_pd(a, b); }
-Vc_INTRINSIC z_i64 Vc_VDECL divides(z_i64 a, z_i64 b) {
-    return {a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3],
-            a[4] / b[4], a[5] / b[5], a[6] / b[6], a[7] / b[7]};
-}
-Vc_INTRINSIC z_u64 Vc_VDECL divides(z_u64 a, z_u64 b) {
-    return {a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3],
-            a[4] / b[4], a[5] / b[5], a[6] / b[6], a[7] / b[7]};
-}
 Vc_INTRINSIC z_i32 Vc_VDECL divides(z_i32 a, z_i32 b) {
     return concat(_mm512_cvttpd_epi32(_mm512_div_pd(_mm512_cvtepi32_pd(lo256(a)),
                                                     _mm512_cvtepi32_pd(lo256(b)))),
@@ -505,6 +707,149 @@ template <class T, size_t N> Vc_INTRINSIC auto modulus(Storage<T, N> a, Storage<
 }
 #endif  // Vc_USE_BUILTIN_VECTOR_TYPES
 
+// 64-bit divides and modulus{{{1
+// There is no SIMD instruction for integer division. The 64-bit quotient is therefore
+// obtained from two double-precision estimates, n · rcp and r · rcp with
+// rcp = (1 - 2⁻⁵⁰) / d. The scale factor exceeds the accumulated rounding errors, thus
+// the estimates, rounded down, never exceed the exact quotient: the first one leaves a
+// remainder below 2¹⁵·d, the second one a remainder below 2·d, and a final comparison
+// subtracts d once more if necessary. All integer steps are exact, thus the result is
+// equal to the scalar division.
+// This only beats the scalar divider with 4 entries and 64-bit conversions
+// between integers and doubles (AVX-512DQ), or with 8 entries (AVX-512F). All other
+// 64-bit divisions and the SSE ones stay scalar.
+// Without AVX-512DQ the conversions between ullong and double work on 32-bit halves via
+// the bit pattern of 2⁵² + x, or the truncating conversion to 32-bit unsigned.
+constexpr double div64_bias = 4503599627370496.;             // 2⁵²
+constexpr double div64_two32 = 4294967296.;                  // 2³²
+constexpr double div64_scale = 1. - 1. / 1125899906842624.;  // 1 - 2⁻⁵⁰
+
+// sse{{{2
+Vc_INTRINSIC x_i64 Vc_VDECL divides(x_i64 a, x_i64 b) { return {a[0] / b[0], a[1] / b[1]}; }
+Vc_INTRINSIC x_u64 Vc_VDECL divides(x_u64 a, x_u64 b) { return {a[0] / b[0], a[1] / b[1]}; }
+Vc_INTRINSIC x_i64 Vc_VDECL modulus(x_i64 a, x_i64 b) { return {a[0] % b[0], a[1] % b[1]}; }
+Vc_INTRINSIC x_u64 Vc_VDECL modulus(x_u64 a, x_u64 b) { return {a[0] % b[0], a[1] % b[1]}; }
+
+// avx{{{2
+#if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512DQ
+// Returns the quotient n / d and stores the remainder to r.
+Vc_INTRINSIC __m256i Vc_VDECL udivmod64(__m256i n, __m256i d, __m256i &r)
+{
+    const __m256d rcp = _mm256_div_pd(_mm256_set1_pd(div64_scale), _mm256_cvtepu64_pd(d));
+    __m256i q = _mm256_cvttpd_epu64(_mm256_mul_pd(_mm256_cvtepu64_pd(n), rcp));
+    r = _mm256_sub_epi64(n, _mm256_mullo_epi64(q, d));
+    const __m256i q2 = _mm256_cvttpd_epu64(_mm256_mul_pd(_mm256_cvtepu64_pd(r), rcp));
+    q = _mm256_add_epi64(q, q2);
+    r = _mm256_sub_epi64(r, _mm256_mullo_epi64(q2, d));
+    const __mmask8 ge = _mm256_cmpge_epu64_mask(r, d);
+    r = _mm256_mask_sub_epi64(r, ge, r, d);
+    return _mm256_mask_add_epi64(q, ge, q, _mm256_set1_epi64x(1));
+}
+
+// Signed division via the absolute values. The quotient is negative iff the signs differ,
+// the remainder has the sign of n.
+Vc_INTRINSIC __m256i Vc_VDECL divmod64(__m256i n, __m256i d, __m256i &r)
+{
+    const __m256i n_sign = _mm256_srai_epi64(n, 63);
+    const __m256i q_sign = _mm256_srai_epi64(xor_(n, d), 63);
+    const __m256i q = udivmod64(_mm256_abs_epi64(n), _mm256_abs_epi64(d), r);
+    r = _mm256_sub_epi64(xor_(r, n_sign), n_sign);
+    return _mm256_sub_epi64(xor_(q, q_sign), q_sign);
+}
+
+Vc_INTRINSIC __m256i Vc_VDECL divides(y_u64 a, y_u64 b) { __m256i r; return udivmod64(a, b, r); }
+Vc_INTRINSIC __m256i Vc_VDECL divides(y_i64 a, y_i64 b) { __m256i r; return divmod64(a, b, r); }
+Vc_INTRINSIC __m256i Vc_VDECL modulus(y_u64 a, y_u64 b)
+{
+    __m256i r;
+    udivmod64(a, b, r);
+    return r;
+}
+Vc_INTRINSIC __m256i Vc_VDECL modulus(y_i64 a, y_i64 b)
+{
+    __m256i r;
+    divmod64(a, b, r);
+    return r;
+}
+#elif defined Vc_HAVE_AVX2
+Vc_INTRINSIC y_i64 Vc_VDECL divides(y_i64 a, y_i64 b) { return {a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3]}; }
+Vc_INTRINSIC y_u64 Vc_VDECL divides(y_u64 a, y_u64 b) { return {a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3]}; }
+Vc_INTRINSIC y_i64 Vc_VDECL modulus(y_i64 a, y_i64 b) { return {a[0] % b[0], a[1] % b[1], a[2] % b[2], a[3] % b[3]}; }
+Vc_INTRINSIC y_u64 Vc_VDECL modulus(y_u64 a, y_u64 b) { return {a[0] % b[0], a[1] % b[1], a[2] % b[2], a[3] % b[3]}; }
+#endif  // Vc_HAVE_AVX512VL && Vc_HAVE_AVX512DQ
+
+// avx512{{{2
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512d Vc_VDECL div64_cvt_pd(__m512i x)
+{
+#ifdef Vc_HAVE_AVX512DQ
+    return _mm512_cvtepu64_pd(x);
+#else
+    const __m512d bias = _mm512_set1_pd(div64_bias);
+    const __m512i bias_bits = _mm512_castpd_si512(bias);
+    const __m512d lo = _mm512_sub_pd(
+        _mm512_castsi512_pd(_mm512_mask_blend_epi32(0xaaaa, x, bias_bits)), bias);
+    const __m512d hi = _mm512_sub_pd(
+        _mm512_castsi512_pd(or_(_mm512_srli_epi64(x, 32), bias_bits)), bias);
+    return _mm512_fmadd_pd(hi, _mm512_set1_pd(div64_two32), lo);
+#endif
+}
+
+Vc_INTRINSIC __m512i Vc_VDECL div64_cvt_epu64(__m512d x)
+{
+#ifdef Vc_HAVE_AVX512DQ
+    return _mm512_cvttpd_epu64(x);
+#else
+    // the conversion to 32-bit unsigned truncates, which is exact for the upper half
+    const __m512d hi = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1. / div64_two32)),
+                                            _MM_FROUND_TO_ZERO);
+    const __m512d lo = _mm512_fnmadd_pd(hi, _mm512_set1_pd(div64_two32), x);
+    return _mm512_add_epi64(
+        _mm512_slli_epi64(_mm512_cvtepu32_epi64(_mm512_cvttpd_epu32(hi)), 32),
+        _mm512_cvtepu32_epi64(_mm512_cvttpd_epu32(lo)));
+#endif
+}
+
+Vc_INTRINSIC __m512i Vc_VDECL udivmod64(__m512i n, __m512i d, __m512i &r)
+{
+    const __m512d rcp = _mm512_div_pd(_mm512_set1_pd(div64_scale), div64_cvt_pd(d));
+    __m512i q =
+        div64_cvt_epu64(_mm512_mul_pd(div64_cvt_pd(n), rcp));
+    r = _mm512_sub_epi64(n, mullo_epi64(q, d));
+    const __m512i q2 = _mm512_cvtepu32_epi64(
+        _mm512_cvttpd_epu32(_mm512_mul_pd(div64_cvt_pd(r), rcp)));
+    q = _mm512_add_epi64(q, q2);
+    r = _mm512_sub_epi64(r, mullo_epi64(q2, d));
+    const __mmask8 ge = _mm512_cmpge_epu64_mask(r, d);
+    r = _mm512_mask_sub_epi64(r, ge, r, d);
+    return _mm512_mask_add_epi64(q, ge, q, _mm512_set1_epi64(1));
+}
+
+Vc_INTRINSIC __m512i Vc_VDECL divmod64(__m512i n, __m512i d, __m512i &r)
+{
+    const __m512i n_sign = _mm512_srai_epi64(n, 63);
+    const __m512i q_sign = _mm512_srai_epi64(xor_(n, d), 63);
+    const __m512i q = udivmod64(_mm512_abs_epi64(n), _mm512_abs_epi64(d), r);
+    r = _mm512_sub_epi64(xor_(r, n_sign), n_sign);
+    return _mm512_sub_epi64(xor_(q, q_sign), q_sign);
+}
+
+Vc_INTRINSIC __m512i Vc_VDECL divides(z_u64 a, z_u64 b) { __m512i r; return udivmod64(a, b, r); }
+Vc_INTRINSIC __m512i Vc_VDECL divides(z_i64 a, z_i64 b) { __m512i r; return divmod64(a, b, r); }
+Vc_INTRINSIC __m512i Vc_VDECL modulus(z_u64 a, z_u64 b)
+{
+    __m512i r;
+    udivmod64(a, b, r);
+    return r;
+}
+Vc_INTRINSIC __m512i Vc_VDECL modulus(z_i64 a, z_i64 b)
+{
+    __m512i r;
+    divmod64(a, b, r);
+    return r;
+}
+#endif  // Vc_HAVE_AVX512F
+
 // bit_and{{{1
 template <class T, size_t N> Vc_INTRINSIC auto bit_and(Storage<T, N> a, Storage<T, N> b)
 {
@@ -702,6 +1047,59 @@ Vc_INTRINSIC z_u08 bit_shift_left(z_u08 a, z_u08 b) { return z_u08(bit_shift_lef
 #endif  // Vc_HAVE_AVX2
 #endif  // Vc_USE_BUILTIN_VECTOR_TYPES
 
+// bit_shift_left by a uniform count{{{1
+#ifdef Vc_USE_BUILTIN_VECTOR_TYPES
+template <class T, size_t N> Vc_INTRINSIC auto bit_shift_left(Storage<T, N> a, int b)
+{
+    static_assert(std::is_integral<T>::value, "bit_shift_left is only supported for integral types");
+    return a.builtin() << b;
+}
+#else   // Vc_USE_BUILTIN_VECTOR_TYPES
+
+// generic scalar fallback
+template <class T, size_t N> Vc_INTRINSIC auto bit_shift_left(Storage<T, N> a, int b)
+{
+    static_assert(std::is_integral<T>::value, "bit_shift_left is only supported for integral types");
+    return generate_from_n_evaluations<N, Storage<T, N>>(
+        [&](auto i) { return a[i] << b; });
+}
+
+// the shift count is passed in the low 64 bits of an xmm register, there are no 8-bit
+// shifts: shift 16-bit words and clear the bits shifted in from the neighboring byte
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_i64 a, int b) { return _mm_sll_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_u64 a, int b) { return _mm_sll_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_i32 a, int b) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_u32 a, int b) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_i16 a, int b) { return _mm_sll_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_u16 a, int b) { return _mm_sll_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_i08 a, int b) { return and_(_mm_sll_epi16(a, _mm_cvtsi32_si128(b)), _mm_set1_epi8(schar(0xff << b))); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_left(x_u08 a, int b) { return and_(_mm_sll_epi16(a, _mm_cvtsi32_si128(b)), _mm_set1_epi8(schar(0xff << b))); }
+
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_i64 a, int b) { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_u64 a, int b) { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_i32 a, int b) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_u32 a, int b) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_i16 a, int b) { return _mm256_sll_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_u16 a, int b) { return _mm256_sll_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_i08 a, int b) { return and_(_mm256_sll_epi16(a, _mm_cvtsi32_si128(b)), _mm256_set1_epi8(schar(0xff << b))); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_left(y_u08 a, int b) { return and_(_mm256_sll_epi16(a, _mm_cvtsi32_si128(b)), _mm256_set1_epi8(schar(0xff << b))); }
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_i64 a, int b) { return _mm512_sll_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_u64 a, int b) { return _mm512_sll_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_i32 a, int b) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_u32 a, int b) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(b)); }
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_i16 a, int b) { return _mm512_sll_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_u16 a, int b) { return _mm512_sll_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_i08 a, int b) { return and_(_mm512_sll_epi16(a, _mm_cvtsi32_si128(b)), _mm512_set1_epi8(schar(0xff << b))); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_left(z_u08 a, int b) { return and_(_mm512_sll_epi16(a, _mm_cvtsi32_si128(b)), _mm512_set1_epi8(schar(0xff << b))); }
+#endif  // Vc_HAVE_AVX512BW
+#endif  // Vc_HAVE_AVX512F
+#endif  // Vc_USE_BUILTIN_VECTOR_TYPES
+
 // bit_shift_right{{{1
 #ifdef Vc_USE_BUILTIN_VECTOR_TYPES
 template <class T, size_t N> Vc_INTRINSIC auto bit_shift_right(Storage<T, N> a, Storage<T, N> b)
@@ -746,7 +1144,7 @@ Vc_INTRINSIC z_u32 bit_shift_right(z_u32 a, z_u32 b) { return _mm512_srlv_epi32(
 Vc_INTRINSIC z_i16 bit_shift_right(z_i16 a, z_i16 b) { return _mm512_srav_epi16(a, b); }
 Vc_INTRINSIC z_u16 bit_shift_right(z_u16 a, z_u16 b) { return _mm512_srlv_epi16(a, b); }
 Vc_INTRINSIC y_i08 bit_shift_right(y_i08 a, y_i08 b) { return _mm512_cvtepi16_epi8(_mm512_srav_epi16(_mm512_cvtepi8_epi16(a), _mm512_cvtepi8_epi16(b))); }
-Vc_INTRINSIC y_u08 bit_shift_right(y_u08 a, y_u08 b) { return _mm512_cvtepi16_epi8(_mm512_srlv_epi16(_mm512_cvtepi8_epi16(a), _mm512_cvtepi8_epi16(b))); }
+Vc_INTRINSIC y_u08 bit_shift_right(y_u08 a, y_u08 b) { return _mm512_cvtepi16_epi8(_mm512_srlv_epi16(_mm512_cvtepu8_epi16(a), _mm512_cvtepu8_epi16(b))); }
 Vc_INTRINSIC z_i08 bit_shift_right(z_i08 a, z_i08 b) { return concat(bit_shift_right(lo256(a), lo256(b)), bit_shift_right(hi256(a), hi256(b))); }
 Vc_INTRINSIC z_u08 bit_shift_right(z_u08 a, z_u08 b) { return concat(bit_shift_right(lo256(a), lo256(b)), bit_shift_right(hi256(a), hi256(b))); }
 #ifdef Vc_HAVE_AVX512VL
@@ -755,7 +1153,7 @@ Vc_INTRINSIC y_u16 bit_shift_right(y_u16 a, y_u16 b) { return _mm256_srlv_epi16(
 Vc_INTRINSIC x_i16 bit_shift_right(x_i16 a, x_i16 b) { return _mm_srav_epi16(a, b); }
 Vc_INTRINSIC x_u16 bit_shift_right(x_u16 a, x_u16 b) { return _mm_srlv_epi16(a, b); }
 Vc_INTRINSIC x_i08 bit_shift_right(x_i08 a, x_i08 b) { return _mm256_cvtepi16_epi8(_mm256_srav_epi16(_mm256_cvtepi8_epi16(a), _mm256_cvtepi8_epi16(b))); }
-Vc_INTRINSIC x_u08 bit_shift_right(x_u08 a, x_u08 b) { return _mm256_cvtepi16_epi8(_mm256_srlv_epi16(_mm256_cvtepi8_epi16(a), _mm256_cvtepi8_epi16(b))); }
+Vc_INTRINSIC x_u08 bit_shift_right(x_u08 a, x_u08 b) { return _mm256_cvtepi16_epi8(_mm256_srlv_epi16(_mm256_cvtepu8_epi16(a), _mm256_cvtepu8_epi16(b))); }
 #else   // Vc_HAVE_AVX512VL
 Vc_INTRINSIC y_i16 bit_shift_right(y_i16 a, y_i16 b) { return lo256(_mm512_srav_epi16(intrin_cast<__m512i>(a), intrin_cast<__m512i>(b)); }
 Vc_INTRINSIC y_u16 bit_shift_right(y_u16 a, y_u16 b) { return lo256(_mm512_srlv_epi16(intrin_cast<__m512i>(a), intrin_cast<__m512i>(b)); }
@@ -868,6 +1266,91 @@ Vc_INTRINSIC z_u08 bit_shift_right(z_u08 a, z_u08 b) { return z_u08(bit_shift_ri
 #endif  // Vc_HAVE_AVX2
 #endif  // Vc_USE_BUILTIN_VECTOR_TYPES
 
+// bit_shift_right by a uniform count{{{1
+#ifdef Vc_USE_BUILTIN_VECTOR_TYPES
+template <class T, size_t N> Vc_INTRINSIC auto bit_shift_right(Storage<T, N> a, int b)
+{
+    static_assert(std::is_integral<T>::value, "bit_shift_right is only supported for integral types");
+    return a.builtin() >> b;
+}
+#else   // Vc_USE_BUILTIN_VECTOR_TYPES
+
+// generic scalar fallback
+template <class T, size_t N> Vc_INTRINSIC auto bit_shift_right(Storage<T, N> a, int b)
+{
+    static_assert(std::is_integral<T>::value, "bit_shift_right is only supported for integral types");
+    return generate_from_n_evaluations<N, Storage<T, N>>(
+        [&](auto i) { return a[i] >> b; });
+}
+
+// Arithmetic shifts of 8-bit (and pre-AVX512 64-bit) elements are emulated: shifting
+// x + 0x80 logically is equal to shifting x arithmetically plus 0x80 >> b, and for
+// negative x, ~(~x >> b) is equal to x >> b.
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_u64 a, int b) { return _mm_srl_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_i64 a, int b)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm_sra_epi64(a, _mm_cvtsi32_si128(b));
+#else
+    const __m128i sign = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), 0xf5);
+    return xor_(_mm_srl_epi64(xor_(a, sign), _mm_cvtsi32_si128(b)), sign);
+#endif
+}
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_u32 a, int b) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_i32 a, int b) { return _mm_sra_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_u16 a, int b) { return _mm_srl_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_i16 a, int b) { return _mm_sra_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_u08 a, int b) { return and_(_mm_srl_epi16(a, _mm_cvtsi32_si128(b)), _mm_set1_epi8(schar(0xff >> b))); }
+Vc_INTRINSIC __m128i Vc_VDECL bit_shift_right(x_i08 a, int b)
+{
+    const __m128i bias = _mm_set1_epi8(schar(0x80));
+    return _mm_sub_epi8(bit_shift_right(x_u08(xor_(a, bias)), b),
+                        _mm_set1_epi8(schar(0x80 >> b)));
+}
+
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_u64 a, int b) { return _mm256_srl_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_i64 a, int b)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm256_sra_epi64(a, _mm_cvtsi32_si128(b));
+#else
+    const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    return xor_(_mm256_srl_epi64(xor_(a, sign), _mm_cvtsi32_si128(b)), sign);
+#endif
+}
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_u32 a, int b) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_i32 a, int b) { return _mm256_sra_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_u16 a, int b) { return _mm256_srl_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_i16 a, int b) { return _mm256_sra_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_u08 a, int b) { return and_(_mm256_srl_epi16(a, _mm_cvtsi32_si128(b)), _mm256_set1_epi8(schar(0xff >> b))); }
+Vc_INTRINSIC __m256i Vc_VDECL bit_shift_right(y_i08 a, int b)
+{
+    const __m256i bias = _mm256_set1_epi8(schar(0x80));
+    return _mm256_sub_epi8(bit_shift_right(y_u08(xor_(a, bias)), b),
+                           _mm256_set1_epi8(schar(0x80 >> b)));
+}
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_u64 a, int b) { return _mm512_srl_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_i64 a, int b) { return _mm512_sra_epi64(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_u32 a, int b) { return _mm512_srl_epi32(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_i32 a, int b) { return _mm512_sra_epi32(a, _mm_cvtsi32_si128(b)); }
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_u16 a, int b) { return _mm512_srl_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_i16 a, int b) { return _mm512_sra_epi16(a, _mm_cvtsi32_si128(b)); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_u08 a, int b) { return and_(_mm512_srl_epi16(a, _mm_cvtsi32_si128(b)), _mm512_set1_epi8(schar(0xff >> b))); }
+Vc_INTRINSIC __m512i Vc_VDECL bit_shift_right(z_i08 a, int b)
+{
+    const __m512i bias = _mm512_set1_epi8(schar(0x80));
+    return _mm512_sub_epi8(bit_shift_right(z_u08(xor_(a, bias)), b),
+                           _mm512_set1_epi8(schar(0x80 >> b)));
+}
+#endif  // Vc_HAVE_AVX512BW
+#endif  // Vc_HAVE_AVX512F
+#endif  // Vc_USE_BUILTIN_VECTOR_TYPES
+
 // complement{{{1
 template <typename T> Vc_INTRINSIC auto Vc_VDECL complement(T v) {
 #ifdef Vc_USE_BUILTIN_VECTOR_TYPES
@@ -927,6 +1410,392 @@ Vc_INTRINSIC __m512  Vc_VDECL sqrt(z_f32 v) { return _mm512_sqrt_ps(v); }
 Vc_INTRINSIC __m512d Vc_VDECL sqrt(z_f64 v) { return _mm512_sqrt_pd(v); }
 #endif  // Vc_HAVE_AVX512F
 
+// exponent{{{1
+// Returns ⌊log₂(v)⌋ for positive normal v. Shifting the exponent bits into the mantissa of
+// 2^(digits-1) yields 2^(digits-1) + biased exponent, which avoids an int -> float conversion.
+#ifdef Vc_HAVE_SSE2
+#ifdef Vc_HAVE_AVX512VL
+Vc_INTRINSIC __m128  Vc_VDECL exponent(x_f32 v) { return _mm_getexp_ps(v); }
+Vc_INTRINSIC __m128d Vc_VDECL exponent(x_f64 v) { return _mm_getexp_pd(v); }
+#else   // Vc_HAVE_AVX512VL
+Vc_INTRINSIC __m128 Vc_VDECL exponent(x_f32 v)
+{
+    return _mm_sub_ps(
+        or_(intrin_cast<__m128>(_mm_srli_epi32(intrin_cast<__m128i>(v.v()), 23)),
+            broadcast16(8388608.f)),
+        broadcast16(8388608.f + 127.f));
+}
+Vc_INTRINSIC __m128d Vc_VDECL exponent(x_f64 v)
+{
+    return _mm_sub_pd(
+        or_(intrin_cast<__m128d>(_mm_srli_epi64(intrin_cast<__m128i>(v.v()), 52)),
+            broadcast16(4503599627370496.)),
+        broadcast16(4503599627370496. + 1023.));
+}
+#endif  // Vc_HAVE_AVX512VL
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+#if defined Vc_HAVE_AVX512VL
+Vc_INTRINSIC __m256  Vc_VDECL exponent(y_f32 v) { return _mm256_getexp_ps(v); }
+Vc_INTRINSIC __m256d Vc_VDECL exponent(y_f64 v) { return _mm256_getexp_pd(v); }
+#elif defined Vc_HAVE_AVX2
+Vc_INTRINSIC __m256 Vc_VDECL exponent(y_f32 v)
+{
+    return _mm256_sub_ps(
+        or_(intrin_cast<__m256>(_mm256_srli_epi32(intrin_cast<__m256i>(v.v()), 23)),
+            broadcast32(8388608.f)),
+        broadcast32(8388608.f + 127.f));
+}
+Vc_INTRINSIC __m256d Vc_VDECL exponent(y_f64 v)
+{
+    return _mm256_sub_pd(
+        or_(intrin_cast<__m256d>(_mm256_srli_epi64(intrin_cast<__m256i>(v.v()), 52)),
+            broadcast32(4503599627370496.)),
+        broadcast32(4503599627370496. + 1023.));
+}
+#else   // Vc_HAVE_AVX2
+Vc_INTRINSIC __m256 Vc_VDECL exponent(y_f32 v)
+{
+    return concat(exponent(x_f32(lo128(v.v()))), exponent(x_f32(hi128(v.v()))));
+}
+Vc_INTRINSIC __m256d Vc_VDECL exponent(y_f64 v)
+{
+    return concat(exponent(x_f64(lo128(v.v()))), exponent(x_f64(hi128(v.v()))));
+}
+#endif  // Vc_HAVE_AVX2
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512  Vc_VDECL exponent(z_f32 v) { return _mm512_getexp_ps(v); }
+Vc_INTRINSIC __m512d Vc_VDECL exponent(z_f64 v) { return _mm512_getexp_pd(v); }
+#endif  // Vc_HAVE_AVX512F
+
+// fraction{{{1
+// Returns v * 2^-(exponent(v) + 1) ∈ [½, 1[ for positive normal v.
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128 Vc_VDECL fraction(x_f32 v)
+{
+    return or_(and_(v.v(), intrin_cast<__m128>(broadcast16(0x007fffffu))),
+               broadcast16(.5f));
+}
+Vc_INTRINSIC __m128d Vc_VDECL fraction(x_f64 v)
+{
+    return or_(and_(v.v(), intrin_cast<__m128d>(broadcast16(0x000fffffffffffffull))),
+               broadcast16(.5));
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+Vc_INTRINSIC __m256 Vc_VDECL fraction(y_f32 v)
+{
+    return or_(and_(v.v(), intrin_cast<__m256>(broadcast32(0x007fffffu))),
+               broadcast32(.5f));
+}
+Vc_INTRINSIC __m256d Vc_VDECL fraction(y_f64 v)
+{
+    return or_(and_(v.v(), intrin_cast<__m256d>(broadcast32(0x000fffffffffffffull))),
+               broadcast32(.5));
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512 Vc_VDECL fraction(z_f32 v)
+{
+    return _mm512_getmant_ps(v, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+}
+Vc_INTRINSIC __m512d Vc_VDECL fraction(z_f64 v)
+{
+    return _mm512_getmant_pd(v, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+}
+#endif  // Vc_HAVE_AVX512F
+
+// exp2_integral{{{1
+// Returns 2ⁿ for integral n in the range of normal exponents. Adding 2^(digits-1) + bias places
+// the biased exponent in the low mantissa bits, from where it is shifted into the exponent.
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128 Vc_VDECL exp2_integral(x_f32 n)
+{
+    return intrin_cast<__m128>(_mm_slli_epi32(
+        intrin_cast<__m128i>(_mm_add_ps(n, broadcast16(8388608.f + 127.f))), 23));
+}
+Vc_INTRINSIC __m128d Vc_VDECL exp2_integral(x_f64 n)
+{
+    return intrin_cast<__m128d>(_mm_slli_epi64(
+        intrin_cast<__m128i>(_mm_add_pd(n, broadcast16(4503599627370496. + 1023.))), 52));
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256 Vc_VDECL exp2_integral(y_f32 n)
+{
+    return intrin_cast<__m256>(_mm256_slli_epi32(
+        intrin_cast<__m256i>(_mm256_add_ps(n, broadcast32(8388608.f + 127.f))), 23));
+}
+Vc_INTRINSIC __m256d Vc_VDECL exp2_integral(y_f64 n)
+{
+    return intrin_cast<__m256d>(_mm256_slli_epi64(
+        intrin_cast<__m256i>(_mm256_add_pd(n, broadcast32(4503599627370496. + 1023.))), 52));
+}
+#else   // Vc_HAVE_AVX2
+Vc_INTRINSIC __m256 Vc_VDECL exp2_integral(y_f32 n)
+{
+    return concat(exp2_integral(x_f32(lo128(n.v()))), exp2_integral(x_f32(hi128(n.v()))));
+}
+Vc_INTRINSIC __m256d Vc_VDECL exp2_integral(y_f64 n)
+{
+    return concat(exp2_integral(x_f64(lo128(n.v()))), exp2_integral(x_f64(hi128(n.v()))));
+}
+#endif  // Vc_HAVE_AVX2
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512  Vc_VDECL exp2_integral(z_f32 n) { return _mm512_scalef_ps(broadcast64(1.f), n); }
+Vc_INTRINSIC __m512d Vc_VDECL exp2_integral(z_f64 n) { return _mm512_scalef_pd(broadcast64(1.), n); }
+#endif  // Vc_HAVE_AVX512F
+
+// fma{{{1
+// Without FMA hardware the result is emulated with a single rounding, using rounding to odd
+// [Boldo & Melquiond, "Emulation of FMA and correctly rounded sums", 2008]: if x is rounded to
+// odd with at least two more bits of precision, rounding that value to nearest yields the same
+// result as rounding the exact x to nearest.
+#ifdef Vc_HAVE_SSE2
+#if !defined Vc_HAVE_FMA && !defined Vc_HAVE_FMA4
+// Returns a + b rounded to odd, i.e. if the sum is inexact the neighbor with odd mantissa is
+// selected. The rounding error of the sum determines the direction of that neighbor.
+Vc_INTRINSIC __m128d Vc_VDECL plus_round_to_odd(__m128d a, __m128d b)
+{
+    const __m128d s = _mm_add_pd(a, b);
+    const __m128d b_ = _mm_sub_pd(s, a);
+    const __m128d err = _mm_add_pd(_mm_sub_pd(a, _mm_sub_pd(s, b_)), _mm_sub_pd(b, b_));
+    const __m128d zero = _mm_setzero_pd();
+    // ordered compares, so that NaN and infinity do not count as inexact
+    const __m128i inexact =
+        _mm_castpd_si128(or_(_mm_cmplt_pd(err, zero), _mm_cmpgt_pd(err, zero)));
+    const __m128i towards_zero =
+        _mm_castpd_si128(xor_(_mm_cmplt_pd(err, zero), _mm_cmplt_pd(s, zero)));
+    const __m128i s_bits = _mm_castpd_si128(s);
+    // 1 where the odd neighbor differs from s, i.e. the inexact sum has an even mantissa
+    const __m128i step = and_(inexact, _mm_andnot_si128(s_bits, _mm_set1_epi64x(1)));
+    return _mm_castsi128_pd(_mm_add_epi64(
+        s_bits, _mm_sub_epi64(xor_(step, towards_zero), towards_zero)));
+}
+
+// Returns the exact a * b as the unevaluated sum of the return value and lo (Dekker).
+Vc_INTRINSIC __m128d Vc_VDECL exact_multiplies(__m128d a, __m128d b, __m128d &lo)
+{
+    const __m128d splitter = broadcast16(134217729.);  // 2^27 + 1
+    const __m128d a_ = _mm_mul_pd(a, splitter);
+    const __m128d b_ = _mm_mul_pd(b, splitter);
+    const __m128d a_hi = _mm_sub_pd(a_, _mm_sub_pd(a_, a));
+    const __m128d b_hi = _mm_sub_pd(b_, _mm_sub_pd(b_, b));
+    const __m128d a_lo = _mm_sub_pd(a, a_hi);
+    const __m128d b_lo = _mm_sub_pd(b, b_hi);
+    const __m128d hi = _mm_mul_pd(a, b);
+    lo = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_sub_pd(_mm_mul_pd(a_hi, b_hi), hi),
+                                          _mm_mul_pd(a_hi, b_lo)),
+                               _mm_mul_pd(a_lo, b_hi)),
+                    _mm_mul_pd(a_lo, b_lo));
+    return hi;
+}
+#endif  // !Vc_HAVE_FMA && !Vc_HAVE_FMA4
+
+Vc_INTRINSIC __m128 Vc_VDECL fma(x_f32 a, x_f32 b, x_f32 c)
+{
+#if defined Vc_HAVE_FMA
+    return _mm_fmadd_ps(a, b, c);
+#elif defined Vc_HAVE_FMA4
+    return _mm_macc_ps(a, b, c);
+#else
+    // The product of two floats is exact in double and the sum is rounded to odd with 53
+    // bits, which is then rounded to 24 bits by the conversion.
+    const auto lo = [](__m128 x) { return _mm_cvtps_pd(x); };
+    const auto hi = [](__m128 x) { return _mm_cvtps_pd(_mm_movehl_ps(x, x)); };
+    return _mm_movelh_ps(
+        _mm_cvtpd_ps(plus_round_to_odd(_mm_mul_pd(lo(a), lo(b)), lo(c))),
+        _mm_cvtpd_ps(plus_round_to_odd(_mm_mul_pd(hi(a), hi(b)), hi(c))));
+#endif
+}
+
+Vc_INTRINSIC __m128d Vc_VDECL fma(x_f64 a, x_f64 b, x_f64 c)
+{
+#if defined Vc_HAVE_FMA
+    return _mm_fmadd_pd(a, b, c);
+#elif defined Vc_HAVE_FMA4
+    return _mm_macc_pd(a, b, c);
+#else
+    // The exact product p_hi + p_lo is added to c with the correctly rounded sum of three
+    // terms: (u_hi, u_lo) = c ⊕ p_lo, (t_hi, t_lo) = p_hi ⊕ u_hi, r = t_hi + ro(t_lo + u_lo).
+    // This is exact unless the splitting or the product over- or underflows; those lanes are
+    // recomputed with std::fma below.
+    __m128d p_lo;
+    const __m128d p_hi = exact_multiplies(a, b, p_lo);
+    const __m128d u_hi = _mm_add_pd(c, p_lo);
+    const __m128d u_ = _mm_sub_pd(u_hi, c);
+    const __m128d u_lo = _mm_add_pd(_mm_sub_pd(c, _mm_sub_pd(u_hi, u_)), _mm_sub_pd(p_lo, u_));
+    const __m128d t_hi = _mm_add_pd(p_hi, u_hi);
+    const __m128d t_ = _mm_sub_pd(t_hi, p_hi);
+    const __m128d t_lo =
+        _mm_add_pd(_mm_sub_pd(p_hi, _mm_sub_pd(t_hi, t_)), _mm_sub_pd(u_hi, t_));
+    const __m128d r = _mm_add_pd(t_hi, plus_round_to_odd(t_lo, u_lo));
+    // Non-finite results (NaN from inf - inf in the error terms) and zero results (where the
+    // sign of zero must follow a * b + c) use the plain expression. If a and b are finite,
+    // a non-finite c is the result even if the rounded product overflows.
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d use_plain =
+        or_(_mm_cmpeq_pd(r, zero), _mm_cmpunord_pd(_mm_sub_pd(r, r), zero));
+    const __m128d use_c =
+        and_(_mm_cmpunord_pd(_mm_sub_pd(c, c), zero),
+             _mm_cmpord_pd(_mm_add_pd(_mm_mul_pd(a, zero), _mm_mul_pd(b, zero)), zero));
+    const __m128d result = blend(use_plain, r, blend(use_c, _mm_add_pd(p_hi, c), c));
+
+    // The emulation is inexact if |a| or |b| exceed 2^995 (the splitter overflows), if a
+    // non-zero product is below 2^-900 (p_lo loses bits to underflow) or above 2^1000, or if
+    // |c| exceeds 2^1020 (t_hi may overflow although the result does not).
+    const auto pow2 = [](int e) {
+        return _mm_castsi128_pd(_mm_set1_epi64x(static_cast<long long>(e + 1023) << 52));
+    };
+    const __m128d abs_p = abs(p_hi);
+    const __m128d out_of_range = or_(
+        or_(_mm_cmpgt_pd(abs(a), pow2(995)),
+            _mm_cmpgt_pd(abs(b), pow2(995))),
+        or_(or_(_mm_cmpgt_pd(abs_p, pow2(1000)),
+                _mm_cmpgt_pd(abs(c), pow2(1020))),
+            and_(_mm_cmplt_pd(abs_p, pow2(-900)),
+                 and_(_mm_cmpneq_pd(a, zero), _mm_cmpneq_pd(b, zero)))));
+    const int lanes = _mm_movemask_pd(out_of_range);
+    if (Vc_IS_UNLIKELY(lanes != 0)) {
+        alignas(16) double tmp[2];
+        _mm_store_pd(tmp, result);
+        for (int i = 0; i < 2; ++i) {
+            if (lanes & (1 << i)) {
+                tmp[i] = std::fma(a.m(i), b.m(i), c.m(i));
+            }
+        }
+        return _mm_load_pd(tmp);
+    }
+    return result;
+#endif
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+Vc_INTRINSIC __m256 Vc_VDECL fma(y_f32 a, y_f32 b, y_f32 c)
+{
+#if defined Vc_HAVE_FMA
+    return _mm256_fmadd_ps(a, b, c);
+#elif defined Vc_HAVE_FMA4
+    return _mm256_macc_ps(a, b, c);
+#else
+    return concat(fma(x_f32(lo128(a.v())), x_f32(lo128(b.v())), x_f32(lo128(c.v()))),
+                  fma(x_f32(hi128(a.v())), x_f32(hi128(b.v())), x_f32(hi128(c.v()))));
+#endif
+}
+Vc_INTRINSIC __m256d Vc_VDECL fma(y_f64 a, y_f64 b, y_f64 c)
+{
+#if defined Vc_HAVE_FMA
+    return _mm256_fmadd_pd(a, b, c);
+#elif defined Vc_HAVE_FMA4
+    return _mm256_macc_pd(a, b, c);
+#else
+    return concat(fma(x_f64(lo128(a.v())), x_f64(lo128(b.v())), x_f64(lo128(c.v()))),
+                  fma(x_f64(hi128(a.v())), x_f64(hi128(b.v())), x_f64(hi128(c.v()))));
+#endif
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512  Vc_VDECL fma(z_f32 a, z_f32 b, z_f32 c) { return _mm512_fmadd_ps(a, b, c); }
+Vc_INTRINSIC __m512d Vc_VDECL fma(z_f64 a, z_f64 b, z_f64 c) { return _mm512_fmadd_pd(a, b, c); }
+#endif  // Vc_HAVE_AVX512F
+
+// add_sat{{{1
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128i Vc_VDECL add_sat(x_i16 a, x_i16 b) { return _mm_adds_epi16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL add_sat(x_u16 a, x_u16 b) { return _mm_adds_epu16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL add_sat(x_i08 a, x_i08 b) { return _mm_adds_epi8 (a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL add_sat(x_u08 a, x_u08 b) { return _mm_adds_epu8 (a, b); }
+#endif  // Vc_HAVE_SSE2
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL add_sat(y_i16 a, y_i16 b) { return _mm256_adds_epi16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL add_sat(y_u16 a, y_u16 b) { return _mm256_adds_epu16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL add_sat(y_i08 a, y_i08 b) { return _mm256_adds_epi8 (a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL add_sat(y_u08 a, y_u08 b) { return _mm256_adds_epu8 (a, b); }
+#endif  // Vc_HAVE_AVX2
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i Vc_VDECL add_sat(z_i16 a, z_i16 b) { return _mm512_adds_epi16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL add_sat(z_u16 a, z_u16 b) { return _mm512_adds_epu16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL add_sat(z_i08 a, z_i08 b) { return _mm512_adds_epi8 (a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL add_sat(z_u08 a, z_u08 b) { return _mm512_adds_epu8 (a, b); }
+#endif  // Vc_HAVE_AVX512BW
+
+// sub_sat{{{1
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128i Vc_VDECL sub_sat(x_i16 a, x_i16 b) { return _mm_subs_epi16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL sub_sat(x_u16 a, x_u16 b) { return _mm_subs_epu16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL sub_sat(x_i08 a, x_i08 b) { return _mm_subs_epi8 (a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL sub_sat(x_u08 a, x_u08 b) { return _mm_subs_epu8 (a, b); }
+#endif  // Vc_HAVE_SSE2
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL sub_sat(y_i16 a, y_i16 b) { return _mm256_subs_epi16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL sub_sat(y_u16 a, y_u16 b) { return _mm256_subs_epu16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL sub_sat(y_i08 a, y_i08 b) { return _mm256_subs_epi8 (a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL sub_sat(y_u08 a, y_u08 b) { return _mm256_subs_epu8 (a, b); }
+#endif  // Vc_HAVE_AVX2
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i Vc_VDECL sub_sat(z_i16 a, z_i16 b) { return _mm512_subs_epi16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL sub_sat(z_u16 a, z_u16 b) { return _mm512_subs_epu16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL sub_sat(z_i08 a, z_i08 b) { return _mm512_subs_epi8 (a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL sub_sat(z_u08 a, z_u08 b) { return _mm512_subs_epu8 (a, b); }
+#endif  // Vc_HAVE_AVX512BW
+
+// avg{{{1
+// pavgb and pavgw only exist for unsigned entries. Flipping the sign bit maps the signed
+// range monotonically onto the unsigned one, and the average back.
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128i Vc_VDECL avg(x_u16 a, x_u16 b) { return _mm_avg_epu16(a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL avg(x_u08 a, x_u08 b) { return _mm_avg_epu8 (a, b); }
+Vc_INTRINSIC __m128i Vc_VDECL avg(x_i16 a, x_i16 b)
+{
+    const __m128i s = _mm_set1_epi16(-0x8000);
+    return xor_(_mm_avg_epu16(xor_(a, s), xor_(b, s)), s);
+}
+Vc_INTRINSIC __m128i Vc_VDECL avg(x_i08 a, x_i08 b)
+{
+    const __m128i s = _mm_set1_epi8(-0x80);
+    return xor_(_mm_avg_epu8(xor_(a, s), xor_(b, s)), s);
+}
+#endif  // Vc_HAVE_SSE2
+#ifdef Vc_HAVE_AVX2
+Vc_INTRINSIC __m256i Vc_VDECL avg(y_u16 a, y_u16 b) { return _mm256_avg_epu16(a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL avg(y_u08 a, y_u08 b) { return _mm256_avg_epu8 (a, b); }
+Vc_INTRINSIC __m256i Vc_VDECL avg(y_i16 a, y_i16 b)
+{
+    const __m256i s = _mm256_set1_epi16(-0x8000);
+    return xor_(_mm256_avg_epu16(xor_(a, s), xor_(b, s)), s);
+}
+Vc_INTRINSIC __m256i Vc_VDECL avg(y_i08 a, y_i08 b)
+{
+    const __m256i s = _mm256_set1_epi8(-0x80);
+    return xor_(_mm256_avg_epu8(xor_(a, s), xor_(b, s)), s);
+}
+#endif  // Vc_HAVE_AVX2
+#ifdef Vc_HAVE_AVX512BW
+Vc_INTRINSIC __m512i Vc_VDECL avg(z_u16 a, z_u16 b) { return _mm512_avg_epu16(a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL avg(z_u08 a, z_u08 b) { return _mm512_avg_epu8 (a, b); }
+Vc_INTRINSIC __m512i Vc_VDECL avg(z_i16 a, z_i16 b)
+{
+    const __m512i s = _mm512_set1_epi16(-0x8000);
+    return xor_(_mm512_avg_epu16(xor_(a, s), xor_(b, s)), s);
+}
+Vc_INTRINSIC __m512i Vc_VDECL avg(z_i08 a, z_i08 b)
+{
+    const __m512i s = _mm512_set1_epi8(-0x80);
+    return xor_(_mm512_avg_epu8(xor_(a, s), xor_(b, s)), s);
+}
+#endif  // Vc_HAVE_AVX512BW
+
 //}}}1
 
 }}  // namespace detail::x86
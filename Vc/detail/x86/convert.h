@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <iomanip>
 #include "storage.h"
+#include "../float16.h"
 
 Vc_VERSIONED_NAMESPACE_BEGIN
 namespace detail
@@ -3049,6 +3050,167 @@ template <typename To, typename From> Vc_INTRINSIC auto Vc_VDECL convert_all(Fro
         v, std::integral_constant<bool, (From::size() > To::size())>());
 }
 
+// half_to_float / float_to_half {{{1
+// N entries of half occupy the low 2N bytes of an integer register. Without F16C the
+// conversions use the bit manipulations of detail::half_to_float and detail::float_to_half.
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128 half_to_float(size_constant<4>, __m128i h)
+{
+#ifdef Vc_HAVE_F16C
+    return _mm_cvtph_ps(h);
+#else   // Vc_HAVE_F16C
+    const __m128i shifted_exp = _mm_set1_epi32(0x7c00 << 13);
+    const __m128i h32 = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+    __m128i r = _mm_slli_epi32(and_(h32, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exp = and_(r, shifted_exp);
+    r = _mm_add_epi32(r, _mm_set1_epi32((127 - 15) << 23));
+    r = _mm_add_epi32(r, and_(_mm_cmpeq_epi32(exp, shifted_exp),
+                              _mm_set1_epi32((128 - 16) << 23)));
+    const __m128i renormalized = _mm_castps_si128(
+        _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(r, _mm_set1_epi32(1 << 23))),
+                   _mm_castsi128_ps(_mm_set1_epi32(113 << 23))));
+    r = blend(_mm_cmpeq_epi32(exp, _mm_setzero_si128()), r, renormalized);
+    return _mm_castsi128_ps(
+        or_(r, _mm_slli_epi32(and_(h32, _mm_set1_epi32(0x8000)), 16)));
+#endif  // Vc_HAVE_F16C
+}
+
+// Packs the low 16 bits of every 32-bit entry into the low half of the register.
+Vc_INTRINSIC __m128i pack_low16(__m128i x)
+{
+#ifdef Vc_HAVE_SSE4_1
+    return _mm_packus_epi32(x, x);
+#else   // Vc_HAVE_SSE4_1
+    x = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+    return _mm_packs_epi32(x, x);
+#endif  // Vc_HAVE_SSE4_1
+}
+
+Vc_INTRINSIC __m128i float_to_half(size_constant<4>, __m128 x)
+{
+#ifdef Vc_HAVE_F16C
+    return _mm_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+#else   // Vc_HAVE_F16C
+    const __m128i denorm_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    __m128i f = _mm_castps_si128(x);
+    const __m128i sign = and_(f, _mm_set1_epi32(0x80000000u));
+    f = xor_(f, sign);
+    // f is non-negative, thus the signed compares are correct
+    const __m128i overflow = _mm_cmpgt_epi32(f, _mm_set1_epi32(((127 + 16) << 23) - 1));
+    const __m128i inf_nan =
+        or_(_mm_set1_epi32(0x7c00),
+            and_(_mm_cmpgt_epi32(f, _mm_set1_epi32(255 << 23)), _mm_set1_epi32(0x0200)));
+    const __m128i subnormal = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), f);
+    const __m128i denorm = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(denorm_magic))),
+        denorm_magic);
+    const __m128i mant_odd = and_(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+    const __m128i bias = _mm_set1_epi32(int((15u - 127u) << 23) + 0xfff);
+    const __m128i normal =
+        _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, bias), mant_odd), 13);
+    const __m128i r = blend(overflow, blend(subnormal, normal, denorm), inf_nan);
+    return pack_low16(or_(r, _mm_srli_epi32(sign, 16)));
+#endif  // Vc_HAVE_F16C
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+Vc_INTRINSIC __m256 half_to_float(size_constant<8>, __m128i h)
+{
+#ifdef Vc_HAVE_F16C
+    return _mm256_cvtph_ps(h);
+#else   // Vc_HAVE_F16C
+    return concat(half_to_float(size_constant<4>(), h),
+                  half_to_float(size_constant<4>(), _mm_unpackhi_epi64(h, h)));
+#endif  // Vc_HAVE_F16C
+}
+
+Vc_INTRINSIC __m128i float_to_half(size_constant<8>, __m256 x)
+{
+#ifdef Vc_HAVE_F16C
+    return _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+#else   // Vc_HAVE_F16C
+    return _mm_unpacklo_epi64(float_to_half(size_constant<4>(), lo128(x)),
+                              float_to_half(size_constant<4>(), hi128(x)));
+#endif  // Vc_HAVE_F16C
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512 half_to_float(size_constant<16>, __m256i h) { return _mm512_cvtph_ps(h); }
+Vc_INTRINSIC __m256i float_to_half(size_constant<16>, __m512 x)
+{
+    return _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+}
+#endif  // Vc_HAVE_AVX512F
+
+// bfloat16_to_float / float_to_bfloat16 {{{1
+// The conversion to bfloat16 rounds to nearest, ties to even, and keeps NaNs NaN by setting
+// the quiet bit.
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128 bfloat16_to_float(size_constant<4>, __m128i b)
+{
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), b));
+}
+
+Vc_INTRINSIC __m128i float_to_bfloat16(size_constant<4>, __m128 x)
+{
+    const __m128i f = _mm_castps_si128(x);
+    const __m128i odd = and_(_mm_srli_epi32(f, 16), _mm_set1_epi32(1));
+    const __m128i rounded =
+        _mm_srli_epi32(_mm_add_epi32(f, _mm_add_epi32(_mm_set1_epi32(0x7fff), odd)), 16);
+    const __m128i nan = or_(_mm_srli_epi32(f, 16), _mm_set1_epi32(0x40));
+    return pack_low16(blend(_mm_castps_si128(_mm_cmpunord_ps(x, x)), rounded, nan));
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+Vc_INTRINSIC __m256 bfloat16_to_float(size_constant<8>, __m128i b)
+{
+#ifdef Vc_HAVE_AVX2
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(b), 16));
+#else   // Vc_HAVE_AVX2
+    return concat(bfloat16_to_float(size_constant<4>(), b),
+                  bfloat16_to_float(size_constant<4>(), _mm_unpackhi_epi64(b, b)));
+#endif  // Vc_HAVE_AVX2
+}
+
+Vc_INTRINSIC __m128i float_to_bfloat16(size_constant<8>, __m256 x)
+{
+#ifdef Vc_HAVE_AVX2
+    const __m256i f = _mm256_castps_si256(x);
+    const __m256i odd = and_(_mm256_srli_epi32(f, 16), _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_srli_epi32(
+        _mm256_add_epi32(f, _mm256_add_epi32(_mm256_set1_epi32(0x7fff), odd)), 16);
+    const __m256i nan = or_(_mm256_srli_epi32(f, 16), _mm256_set1_epi32(0x40));
+    const __m256i r =
+        blend(_mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q)), rounded, nan);
+    return _mm_packus_epi32(lo128(r), hi128(r));
+#else   // Vc_HAVE_AVX2
+    return _mm_unpacklo_epi64(float_to_bfloat16(size_constant<4>(), lo128(x)),
+                              float_to_bfloat16(size_constant<4>(), hi128(x)));
+#endif  // Vc_HAVE_AVX2
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512 bfloat16_to_float(size_constant<16>, __m256i b)
+{
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(b), 16));
+}
+
+Vc_INTRINSIC __m256i float_to_bfloat16(size_constant<16>, __m512 x)
+{
+    const __m512i f = _mm512_castps_si512(x);
+    const __m512i odd = and_(_mm512_srli_epi32(f, 16), _mm512_set1_epi32(1));
+    const __m512i rounded = _mm512_srli_epi32(
+        _mm512_add_epi32(f, _mm512_add_epi32(_mm512_set1_epi32(0x7fff), odd)), 16);
+    const __m512i nan = or_(_mm512_srli_epi32(f, 16), _mm512_set1_epi32(0x40));
+    return _mm512_cvtepi32_epi16(
+        _mm512_mask_mov_epi32(rounded, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), nan));
+}
+#endif  // Vc_HAVE_AVX512F
+
 // }}}1
 }}  // namespace detail::x86
 Vc_VERSIONED_NAMESPACE_END
@@ -1790,27 +1790,48 @@ template <int n> Vc_INTRINSIC __m128i shift_left(__m128i v) { return _mm_slli_si
 #endif  // Vc_HAVE_SSE2
 
 #ifdef Vc_HAVE_AVX2
+// Shifts the whole register, across the 128-bit lanes. t holds the low half of v in its
+// high half, and zeros in the low half.
+template <int n> Vc_INTRINSIC __m256i shift_left(__m256i v)
+{
+    const __m256i t = _mm256_permute2x128_si256(v, v, 0x08);
+    return n == 0 ? v : n < 16 ? _mm256_alignr_epi8(v, t, n < 16 ? 16 - n : 0)
+                               : _mm256_slli_si256(t, n < 16 ? 0 : n - 16);
+}
 template <int n> Vc_INTRINSIC __m256 shift_left(__m256 v)
 {
-    __m256i vi = _mm256_castps_si256(v);
-    return _mm256_castsi256_ps(
-        n < 16 ? _mm256_slli_si256(vi, n)
-               : _mm256_slli_si256(_mm256_permute2x128_si256(vi, vi, 0x08), n));
+    return _mm256_castsi256_ps(shift_left<n>(_mm256_castps_si256(v)));
 }
 template <int n> Vc_INTRINSIC __m256d shift_left(__m256d v)
 {
-    __m256i vi = _mm256_castpd_si256(v);
-    return _mm256_castsi256_pd(
-        n < 16 ? _mm256_slli_si256(vi, n)
-               : _mm256_slli_si256(_mm256_permute2x128_si256(vi, vi, 0x08), n));
+    return _mm256_castsi256_pd(shift_left<n>(_mm256_castpd_si256(v)));
 }
-template <int n> Vc_INTRINSIC __m256i shift_left(__m256i v)
+#endif  // Vc_HAVE_AVX2
+
+#ifdef Vc_HAVE_AVX512F
+// valignd shifts by multiples of four bytes. Other shifts, which must be less than 16,
+// combine v with the register shifted by 16 bytes in every 128-bit lane.
+template <int n> Vc_INTRINSIC __m512i shift_left(__m512i v)
 {
-    return _mm256_castsi256_pd(
-        n < 16 ? _mm256_slli_si256(v, n)
-               : _mm256_slli_si256(_mm256_permute2x128_si256(v, v, 0x08), n));
+    const __m512i z = _mm512_setzero_si512();
+#ifdef Vc_HAVE_AVX512BW
+    if (n % 4 != 0) {
+        return _mm512_alignr_epi8(v, _mm512_alignr_epi32(v, z, 12), (16 - n) & 15);
+    }
+#else   // Vc_HAVE_AVX512BW
+    static_assert(n % 4 == 0, "shift_left<n>(__m512i) requires AVX512BW for n % 4 != 0");
+#endif  // Vc_HAVE_AVX512BW
+    return n == 0 ? v : _mm512_alignr_epi32(v, z, (16 - n / 4) & 15);
 }
-#endif
+template <int n> Vc_INTRINSIC __m512 shift_left(__m512 v)
+{
+    return _mm512_castsi512_ps(shift_left<n>(_mm512_castps_si512(v)));
+}
+template <int n> Vc_INTRINSIC __m512d shift_left(__m512d v)
+{
+    return _mm512_castsi512_pd(shift_left<n>(_mm512_castpd_si512(v)));
+}
+#endif  // Vc_HAVE_AVX512F
 
 // shift_right{{{1
 template <int n> Vc_INTRINSIC __m128  shift_right(__m128  v);
@@ -1951,7 +1972,9 @@ Vc_INTRINSIC Vc_CONST int firstbit(ullong bits)
 
 Vc_INTRINSIC Vc_CONST auto firstbit(uint x)
 {
-#if defined Vc_ICC || defined Vc_GCC
+#if defined Vc_HAVE_BMI1
+    return int(_tzcnt_u32(x));
+#elif defined Vc_ICC || defined Vc_GCC
     return _bit_scan_forward(x);
 #elif defined Vc_CLANG || defined Vc_APPLECLANG
     return __builtin_ctz(x);
@@ -1979,7 +2002,7 @@ template <class T> Vc_INTRINSIC Vc_CONST auto firstbit(T bits)
 // lastbit{{{1
 Vc_INTRINSIC Vc_CONST int lastbit(ullong bits)
 {
-#ifdef Vc_HAVE_BMI1
+#ifdef Vc_HAVE_LZCNT
 #ifdef Vc_IS_AMD64
     return 63u - _lzcnt_u64(bits);
 #else
@@ -1991,14 +2014,16 @@ Vc_INTRINSIC Vc_CONST int lastbit(ullong bits)
         return 63u - _lzcnt_u32(hi);
     }
 #endif
-#else   // Vc_HAVE_BMI1
+#else   // Vc_HAVE_LZCNT
     return 63 - __builtin_clzll(bits);
-#endif  // Vc_HAVE_BMI1
+#endif  // Vc_HAVE_LZCNT
 }
 
 Vc_INTRINSIC Vc_CONST auto lastbit(uint x)
 {
-#if defined Vc_ICC || defined Vc_GCC
+#if defined Vc_HAVE_LZCNT
+    return int(31u - _lzcnt_u32(x));
+#elif defined Vc_ICC || defined Vc_GCC
     return _bit_scan_reverse(x);
 #elif defined Vc_CLANG || defined Vc_APPLECLANG
     return 31 - __builtin_clz(x);
@@ -2608,6 +2633,437 @@ Vc_INTRINSIC void store64(__m512i v, T *mem, when_unaligned<64>)
 }
 #endif
 
+// stream_load / stream_store{{{1
+// Non-temporal loads and stores of vector-aligned memory. movntdqa only bypasses the caches
+// for write-combining memory; without SSE4.1 / AVX2 it is replaced by an aligned load.
+#ifdef Vc_HAVE_SSE2
+Vc_INTRINSIC __m128i stream_load16(const void *mem)
+{
+    assertCorrectAlignment<__m128i>(mem);
+#ifdef Vc_HAVE_SSE4_1
+    return _mm_stream_load_si128(reinterpret_cast<__m128i *>(const_cast<void *>(mem)));
+#else
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(mem));
+#endif
+}
+Vc_INTRINSIC void stream_store16(__m128 v, float *mem)
+{
+    assertCorrectAlignment<__m128>(mem);
+    _mm_stream_ps(mem, v);
+}
+Vc_INTRINSIC void stream_store16(__m128d v, double *mem)
+{
+    assertCorrectAlignment<__m128d>(mem);
+    _mm_stream_pd(mem, v);
+}
+template <class T> Vc_INTRINSIC void stream_store16(__m128i v, T *mem)
+{
+    assertCorrectAlignment<__m128i>(mem);
+    _mm_stream_si128(reinterpret_cast<__m128i *>(mem), v);
+}
+#endif  // Vc_HAVE_SSE2
+
+#ifdef Vc_HAVE_AVX
+Vc_INTRINSIC __m256i stream_load32(const void *mem)
+{
+    assertCorrectAlignment<__m256i>(mem);
+#ifdef Vc_HAVE_AVX2
+    return _mm256_stream_load_si256(reinterpret_cast<__m256i *>(const_cast<void *>(mem)));
+#else
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(mem));
+#endif
+}
+Vc_INTRINSIC void stream_store32(__m256 v, float *mem)
+{
+    assertCorrectAlignment<__m256>(mem);
+    _mm256_stream_ps(mem, v);
+}
+Vc_INTRINSIC void stream_store32(__m256d v, double *mem)
+{
+    assertCorrectAlignment<__m256d>(mem);
+    _mm256_stream_pd(mem, v);
+}
+template <class T> Vc_INTRINSIC void stream_store32(__m256i v, T *mem)
+{
+    assertCorrectAlignment<__m256i>(mem);
+    _mm256_stream_si256(reinterpret_cast<__m256i *>(mem), v);
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+Vc_INTRINSIC __m512i stream_load64(const void *mem)
+{
+    assertCorrectAlignment<__m512i>(mem);
+    return _mm512_stream_load_si512(const_cast<void *>(mem));
+}
+Vc_INTRINSIC void stream_store64(__m512 v, float *mem)
+{
+    assertCorrectAlignment<__m512>(mem);
+    _mm512_stream_ps(mem, v);
+}
+Vc_INTRINSIC void stream_store64(__m512d v, double *mem)
+{
+    assertCorrectAlignment<__m512d>(mem);
+    _mm512_stream_pd(mem, v);
+}
+template <class T> Vc_INTRINSIC void stream_store64(__m512i v, T *mem)
+{
+    assertCorrectAlignment<__m512i>(mem);
+    _mm512_stream_si512(reinterpret_cast<__m512i *>(mem), v);
+}
+#endif  // Vc_HAVE_AVX512F
+
+// maskload / maskstore{{{1
+// Masked loads and stores that never access the memory of masked-off entries, so that the
+// last partial vector of an array cannot fault on the following page. The loads keep the
+// masked-off entries of merge. With AVX-512VL (AVX-512BW for 8- and 16-bit entries) they
+// use the mask register forms of the unaligned moves, otherwise V(P)MASKMOV.
+//
+// maskload_min_entry_size<VectorSize> is the smallest entry size (in Bytes) for which the
+// VectorSize Bytes wide functions exist.
+template <std::size_t VectorSize>
+constexpr std::size_t maskload_min_entry_size =
+#if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512BW
+    1;
+#elif defined Vc_HAVE_AVX
+    4;
+#else
+    VectorSize;
+#endif
+#ifdef Vc_HAVE_AVX512F
+template <>
+constexpr std::size_t maskload_min_entry_size<64> =
+#ifdef Vc_HAVE_AVX512BW
+    1;
+#else
+    4;
+#endif
+#endif  // Vc_HAVE_AVX512F
+
+template <std::size_t EntrySize>
+using entry_size_tag = std::integral_constant<std::size_t, EntrySize>;
+
+#ifdef Vc_HAVE_AVX
+// 16 Bytes{{{2
+Vc_INTRINSIC __m128 maskload16(__m128 merge, __m128 k, const float *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm_castps_si128(k);
+    return _mm_mask_loadu_ps(merge, _mm_test_epi32_mask(kk, kk), mem);
+#else
+    return _mm_blendv_ps(merge, _mm_maskload_ps(mem, _mm_castps_si128(k)), k);
+#endif
+}
+Vc_INTRINSIC __m128d maskload16(__m128d merge, __m128d k, const double *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm_castpd_si128(k);
+    return _mm_mask_loadu_pd(merge, _mm_test_epi64_mask(kk, kk), mem);
+#else
+    return _mm_blendv_pd(merge, _mm_maskload_pd(mem, _mm_castpd_si128(k)), k);
+#endif
+}
+template <class T>
+Vc_INTRINSIC __m128i maskload16(__m128i merge, __m128i k, const T *mem, entry_size_tag<8>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm_mask_loadu_epi64(merge, _mm_test_epi64_mask(k, k), mem);
+#elif defined Vc_HAVE_AVX2
+    return _mm_blendv_epi8(
+        merge, _mm_maskload_epi64(reinterpret_cast<const long long *>(mem), k), k);
+#else
+    return _mm_castpd_si128(maskload16(_mm_castsi128_pd(merge), _mm_castsi128_pd(k),
+                                       reinterpret_cast<const double *>(mem)));
+#endif
+}
+template <class T>
+Vc_INTRINSIC __m128i maskload16(__m128i merge, __m128i k, const T *mem, entry_size_tag<4>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm_mask_loadu_epi32(merge, _mm_test_epi32_mask(k, k), mem);
+#elif defined Vc_HAVE_AVX2
+    return _mm_blendv_epi8(merge, _mm_maskload_epi32(reinterpret_cast<const int *>(mem), k),
+                           k);
+#else
+    return _mm_castps_si128(maskload16(_mm_castsi128_ps(merge), _mm_castsi128_ps(k),
+                                       reinterpret_cast<const float *>(mem)));
+#endif
+}
+#if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512BW
+template <class T>
+Vc_INTRINSIC __m128i maskload16(__m128i merge, __m128i k, const T *mem, entry_size_tag<2>)
+{
+    return _mm_mask_loadu_epi16(merge, _mm_test_epi16_mask(k, k), mem);
+}
+template <class T>
+Vc_INTRINSIC __m128i maskload16(__m128i merge, __m128i k, const T *mem, entry_size_tag<1>)
+{
+    return _mm_mask_loadu_epi8(merge, _mm_test_epi8_mask(k, k), mem);
+}
+#endif  // Vc_HAVE_AVX512VL && Vc_HAVE_AVX512BW
+template <class T> Vc_INTRINSIC __m128i maskload16(__m128i merge, __m128i k, const T *mem)
+{
+    return maskload16(merge, k, mem, entry_size_tag<sizeof(T)>());
+}
+
+Vc_INTRINSIC void maskstore16(__m128 v, __m128 k, float *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm_castps_si128(k);
+    _mm_mask_storeu_ps(mem, _mm_test_epi32_mask(kk, kk), v);
+#else
+    _mm_maskstore_ps(mem, _mm_castps_si128(k), v);
+#endif
+}
+Vc_INTRINSIC void maskstore16(__m128d v, __m128d k, double *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm_castpd_si128(k);
+    _mm_mask_storeu_pd(mem, _mm_test_epi64_mask(kk, kk), v);
+#else
+    _mm_maskstore_pd(mem, _mm_castpd_si128(k), v);
+#endif
+}
+template <class T>
+Vc_INTRINSIC void maskstore16(__m128i v, __m128i k, T *mem, entry_size_tag<8>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    _mm_mask_storeu_epi64(mem, _mm_test_epi64_mask(k, k), v);
+#elif defined Vc_HAVE_AVX2
+    _mm_maskstore_epi64(reinterpret_cast<long long *>(mem), k, v);
+#else
+    maskstore16(_mm_castsi128_pd(v), _mm_castsi128_pd(k), reinterpret_cast<double *>(mem));
+#endif
+}
+template <class T>
+Vc_INTRINSIC void maskstore16(__m128i v, __m128i k, T *mem, entry_size_tag<4>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    _mm_mask_storeu_epi32(mem, _mm_test_epi32_mask(k, k), v);
+#elif defined Vc_HAVE_AVX2
+    _mm_maskstore_epi32(reinterpret_cast<int *>(mem), k, v);
+#else
+    maskstore16(_mm_castsi128_ps(v), _mm_castsi128_ps(k), reinterpret_cast<float *>(mem));
+#endif
+}
+#if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512BW
+template <class T>
+Vc_INTRINSIC void maskstore16(__m128i v, __m128i k, T *mem, entry_size_tag<2>)
+{
+    _mm_mask_storeu_epi16(mem, _mm_test_epi16_mask(k, k), v);
+}
+template <class T>
+Vc_INTRINSIC void maskstore16(__m128i v, __m128i k, T *mem, entry_size_tag<1>)
+{
+    _mm_mask_storeu_epi8(mem, _mm_test_epi8_mask(k, k), v);
+}
+#endif  // Vc_HAVE_AVX512VL && Vc_HAVE_AVX512BW
+template <class T> Vc_INTRINSIC void maskstore16(__m128i v, __m128i k, T *mem)
+{
+    maskstore16(v, k, mem, entry_size_tag<sizeof(T)>());
+}
+
+// 32 Bytes{{{2
+Vc_INTRINSIC __m256 maskload32(__m256 merge, __m256 k, const float *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm256_castps_si256(k);
+    return _mm256_mask_loadu_ps(merge, _mm256_test_epi32_mask(kk, kk), mem);
+#else
+    return _mm256_blendv_ps(merge, _mm256_maskload_ps(mem, _mm256_castps_si256(k)), k);
+#endif
+}
+Vc_INTRINSIC __m256d maskload32(__m256d merge, __m256d k, const double *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm256_castpd_si256(k);
+    return _mm256_mask_loadu_pd(merge, _mm256_test_epi64_mask(kk, kk), mem);
+#else
+    return _mm256_blendv_pd(merge, _mm256_maskload_pd(mem, _mm256_castpd_si256(k)), k);
+#endif
+}
+template <class T>
+Vc_INTRINSIC __m256i maskload32(__m256i merge, __m256i k, const T *mem, entry_size_tag<8>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm256_mask_loadu_epi64(merge, _mm256_test_epi64_mask(k, k), mem);
+#elif defined Vc_HAVE_AVX2
+    return _mm256_blendv_epi8(
+        merge, _mm256_maskload_epi64(reinterpret_cast<const long long *>(mem), k), k);
+#else
+    return _mm256_castpd_si256(maskload32(_mm256_castsi256_pd(merge),
+                                          _mm256_castsi256_pd(k),
+                                          reinterpret_cast<const double *>(mem)));
+#endif
+}
+template <class T>
+Vc_INTRINSIC __m256i maskload32(__m256i merge, __m256i k, const T *mem, entry_size_tag<4>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    return _mm256_mask_loadu_epi32(merge, _mm256_test_epi32_mask(k, k), mem);
+#elif defined Vc_HAVE_AVX2
+    return _mm256_blendv_epi8(
+        merge, _mm256_maskload_epi32(reinterpret_cast<const int *>(mem), k), k);
+#else
+    return _mm256_castps_si256(maskload32(_mm256_castsi256_ps(merge),
+                                          _mm256_castsi256_ps(k),
+                                          reinterpret_cast<const float *>(mem)));
+#endif
+}
+#if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512BW
+template <class T>
+Vc_INTRINSIC __m256i maskload32(__m256i merge, __m256i k, const T *mem, entry_size_tag<2>)
+{
+    return _mm256_mask_loadu_epi16(merge, _mm256_test_epi16_mask(k, k), mem);
+}
+template <class T>
+Vc_INTRINSIC __m256i maskload32(__m256i merge, __m256i k, const T *mem, entry_size_tag<1>)
+{
+    return _mm256_mask_loadu_epi8(merge, _mm256_test_epi8_mask(k, k), mem);
+}
+#endif  // Vc_HAVE_AVX512VL && Vc_HAVE_AVX512BW
+template <class T> Vc_INTRINSIC __m256i maskload32(__m256i merge, __m256i k, const T *mem)
+{
+    return maskload32(merge, k, mem, entry_size_tag<sizeof(T)>());
+}
+
+Vc_INTRINSIC void maskstore32(__m256 v, __m256 k, float *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm256_castps_si256(k);
+    _mm256_mask_storeu_ps(mem, _mm256_test_epi32_mask(kk, kk), v);
+#else
+    _mm256_maskstore_ps(mem, _mm256_castps_si256(k), v);
+#endif
+}
+Vc_INTRINSIC void maskstore32(__m256d v, __m256d k, double *mem)
+{
+#ifdef Vc_HAVE_AVX512VL
+    const auto kk = _mm256_castpd_si256(k);
+    _mm256_mask_storeu_pd(mem, _mm256_test_epi64_mask(kk, kk), v);
+#else
+    _mm256_maskstore_pd(mem, _mm256_castpd_si256(k), v);
+#endif
+}
+template <class T>
+Vc_INTRINSIC void maskstore32(__m256i v, __m256i k, T *mem, entry_size_tag<8>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    _mm256_mask_storeu_epi64(mem, _mm256_test_epi64_mask(k, k), v);
+#elif defined Vc_HAVE_AVX2
+    _mm256_maskstore_epi64(reinterpret_cast<long long *>(mem), k, v);
+#else
+    maskstore32(_mm256_castsi256_pd(v), _mm256_castsi256_pd(k),
+                reinterpret_cast<double *>(mem));
+#endif
+}
+template <class T>
+Vc_INTRINSIC void maskstore32(__m256i v, __m256i k, T *mem, entry_size_tag<4>)
+{
+#ifdef Vc_HAVE_AVX512VL
+    _mm256_mask_storeu_epi32(mem, _mm256_test_epi32_mask(k, k), v);
+#elif defined Vc_HAVE_AVX2
+    _mm256_maskstore_epi32(reinterpret_cast<int *>(mem), k, v);
+#else
+    maskstore32(_mm256_castsi256_ps(v), _mm256_castsi256_ps(k),
+                reinterpret_cast<float *>(mem));
+#endif
+}
+#if defined Vc_HAVE_AVX512VL && defined Vc_HAVE_AVX512BW
+template <class T>
+Vc_INTRINSIC void maskstore32(__m256i v, __m256i k, T *mem, entry_size_tag<2>)
+{
+    _mm256_mask_storeu_epi16(mem, _mm256_test_epi16_mask(k, k), v);
+}
+template <class T>
+Vc_INTRINSIC void maskstore32(__m256i v, __m256i k, T *mem, entry_size_tag<1>)
+{
+    _mm256_mask_storeu_epi8(mem, _mm256_test_epi8_mask(k, k), v);
+}
+#endif  // Vc_HAVE_AVX512VL && Vc_HAVE_AVX512BW
+template <class T> Vc_INTRINSIC void maskstore32(__m256i v, __m256i k, T *mem)
+{
+    maskstore32(v, k, mem, entry_size_tag<sizeof(T)>());
+}
+#endif  // Vc_HAVE_AVX
+
+#ifdef Vc_HAVE_AVX512F
+// 64 Bytes{{{2
+Vc_INTRINSIC __m512 maskload64(__m512 merge, __mmask16 k, const float *mem)
+{
+    return _mm512_mask_loadu_ps(merge, k, mem);
+}
+Vc_INTRINSIC __m512d maskload64(__m512d merge, __mmask8 k, const double *mem)
+{
+    return _mm512_mask_loadu_pd(merge, k, mem);
+}
+template <class T>
+Vc_INTRINSIC __m512i maskload64(__m512i merge, __mmask8 k, const T *mem, entry_size_tag<8>)
+{
+    return _mm512_mask_loadu_epi64(merge, k, mem);
+}
+template <class T>
+Vc_INTRINSIC __m512i maskload64(__m512i merge, __mmask16 k, const T *mem,
+                                entry_size_tag<4>)
+{
+    return _mm512_mask_loadu_epi32(merge, k, mem);
+}
+#ifdef Vc_HAVE_AVX512BW
+template <class T>
+Vc_INTRINSIC __m512i maskload64(__m512i merge, __mmask32 k, const T *mem,
+                                entry_size_tag<2>)
+{
+    return _mm512_mask_loadu_epi16(merge, k, mem);
+}
+template <class T>
+Vc_INTRINSIC __m512i maskload64(__m512i merge, __mmask64 k, const T *mem,
+                                entry_size_tag<1>)
+{
+    return _mm512_mask_loadu_epi8(merge, k, mem);
+}
+#endif  // Vc_HAVE_AVX512BW
+template <class K, class T>
+Vc_INTRINSIC __m512i maskload64(__m512i merge, K k, const T *mem)
+{
+    return maskload64(merge, k, mem, entry_size_tag<sizeof(T)>());
+}
+
+Vc_INTRINSIC void maskstore64(__m512 v, __mmask16 k, float *mem)
+{
+    _mm512_mask_storeu_ps(mem, k, v);
+}
+Vc_INTRINSIC void maskstore64(__m512d v, __mmask8 k, double *mem)
+{
+    _mm512_mask_storeu_pd(mem, k, v);
+}
+template <class T>
+Vc_INTRINSIC void maskstore64(__m512i v, __mmask8 k, T *mem, entry_size_tag<8>)
+{
+    _mm512_mask_storeu_epi64(mem, k, v);
+}
+template <class T>
+Vc_INTRINSIC void maskstore64(__m512i v, __mmask16 k, T *mem, entry_size_tag<4>)
+{
+    _mm512_mask_storeu_epi32(mem, k, v);
+}
+#ifdef Vc_HAVE_AVX512BW
+template <class T>
+Vc_INTRINSIC void maskstore64(__m512i v, __mmask32 k, T *mem, entry_size_tag<2>)
+{
+    _mm512_mask_storeu_epi16(mem, k, v);
+}
+template <class T>
+Vc_INTRINSIC void maskstore64(__m512i v, __mmask64 k, T *mem, entry_size_tag<1>)
+{
+    _mm512_mask_storeu_epi8(mem, k, v);
+}
+#endif  // Vc_HAVE_AVX512BW
+template <class K, class T> Vc_INTRINSIC void maskstore64(__m512i v, K k, T *mem)
+{
+    maskstore64(v, k, mem, entry_size_tag<sizeof(T)>());
+}
+#endif  // Vc_HAVE_AVX512F
+
 // }}}1
 }  // namespace x86
 using namespace x86;
@@ -36,8 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace Vc_2 {}
 namespace Vc = Vc_2;
 #define Vc_VERSIONED_NAMESPACE Vc_2
-#define Vc_VERSIONED_NAMESPACE_BEGIN namespace Vc_2 {
-#define Vc_VERSIONED_NAMESPACE_END }
+#define Vc_DISPATCH_SHARED_NAMESPACE_BEGIN namespace Vc_2 {
+#define Vc_DISPATCH_SHARED_NAMESPACE_END }
 #else
 namespace Vc
 {
@@ -46,8 +46,22 @@ inline namespace v2
 }  // namespace v2
 }  // namespace Vc
 #define Vc_VERSIONED_NAMESPACE Vc::v2
-#define Vc_VERSIONED_NAMESPACE_BEGIN namespace Vc { inline namespace v2 {
-#define Vc_VERSIONED_NAMESPACE_END }}
+#define Vc_DISPATCH_SHARED_NAMESPACE_BEGIN namespace Vc { inline namespace v2 {
+#define Vc_DISPATCH_SHARED_NAMESPACE_END }}
+#endif
+
+// vc_compile_for_dispatch compiles a source once per dispatch target and defines
+// Vc_DISPATCH_NAMESPACE to a different name for each copy. Everything but the dispatch
+// interface (Vc_DISPATCH_SHARED_NAMESPACE) is then declared in that inline namespace, such
+// that the inline functions and templates of the copies get different symbols and the
+// linker cannot pick one compiled for an instruction set the CPU lacks.
+#ifdef Vc_DISPATCH_NAMESPACE
+#define Vc_VERSIONED_NAMESPACE_BEGIN                                                     \
+    Vc_DISPATCH_SHARED_NAMESPACE_BEGIN inline namespace Vc_DISPATCH_NAMESPACE {
+#define Vc_VERSIONED_NAMESPACE_END } Vc_DISPATCH_SHARED_NAMESPACE_END
+#else
+#define Vc_VERSIONED_NAMESPACE_BEGIN Vc_DISPATCH_SHARED_NAMESPACE_BEGIN
+#define Vc_VERSIONED_NAMESPACE_END Vc_DISPATCH_SHARED_NAMESPACE_END
 #endif
 
 #endif // DOXYGEN
@@ -495,3 +495,75 @@ function(vc_compile_for_all_isa _srcs _src)
    set(${_srcs} "${${_srcs}}" PARENT_SCOPE)
 endfunction()
 
+
+# Generate compile rules for the given C++ source file for every Vc::dispatch_target and
+# return the resulting list of source files in _srcs. The source file registers its kernels
+# with Vc::dispatched objects, which select the best one at runtime (see Vc/detail/dispatch.h).
+# Unlike vc_compile_for_all_isa, Vc_IMPL is not defined, such that the compiler flags alone
+# determine the datapar ABIs. Every copy defines Vc_DISPATCH_NAMESPACE to a target specific
+# name, which moves Vc's inline functions and templates into a namespace of their own (see
+# Vc/version.h), such that the linker cannot mix up the copies.
+# MSVC has no flag for SSE4.2, thus the SSE4_2 target is skipped there.
+# Example:
+#   vc_compile_for_dispatch(_srcs kernels.cpp TARGETS SSE2 AVX2 AVX512)
+#   add_executable(executable main.cpp ${_srcs})
+function(vc_compile_for_dispatch _srcs _src)
+   cmake_parse_arguments(ARG "" "" "FLAGS;TARGETS" ${ARGN})
+   if(ARG_UNPARSED_ARGUMENTS)
+      message(FATAL_ERROR "unrecognized argument(s) '${ARG_UNPARSED_ARGUMENTS}' to vc_compile_for_dispatch")
+   endif()
+   if(NOT ARG_TARGETS)
+      set(ARG_TARGETS SSE2 SSE4_2 AVX AVX2 AVX512)
+   endif()
+
+   set(_flags_SSE2   "-msse2"                         "/arch:SSE2")
+   set(_flags_SSE4_2 "-msse4.2 -mpopcnt")
+   set(_flags_AVX    "-mavx"                          "/arch:AVX")
+   set(_flags_AVX2   "-mavx2 -mfma -mbmi -mbmi2 -mlzcnt" "/arch:AVX2")
+   set(_flags_AVX512 "-mavx2 -mfma -mbmi -mbmi2 -mlzcnt -mavx512f -mavx512cd -mavx512bw -mavx512dq -mavx512vl" "/arch:AVX512")
+
+   get_filename_component(_name "${_src}" NAME_WE)
+   get_filename_component(_ext "${_src}" EXT)
+   foreach(_target ${ARG_TARGETS})
+      if(NOT DEFINED _flags_${_target})
+         message(FATAL_ERROR "unknown target '${_target}' listed in vc_compile_for_dispatch")
+      endif()
+      if(_target STREQUAL "SSE4_2" AND Vc_COMPILER_IS_MSVC)
+         # /arch:SSE2 would put an SSE2 copy into the slot the dispatcher picks on SSE4.2 CPUs
+         message(STATUS "vc_compile_for_dispatch: MSVC cannot compile for SSE4_2, skipping it")
+         continue()
+      endif()
+      set(_extra_flags)
+      set(_ok FALSE)
+      foreach(_flags_it ${_flags_${_target}})
+         string(REPLACE " " ";" _flag_list "${_flags_it}")
+         foreach(_f ${_flag_list})
+            AddCompilerFlag(${_f} CXX_RESULT _ok)
+            if(NOT _ok)
+               break()
+            endif()
+         endforeach()
+         if(_ok)
+            set(_extra_flags ${_flags_it})
+            break()
+         endif()
+      endforeach()
+      if(_ok)
+         set(_out "${CMAKE_CURRENT_BINARY_DIR}/${_name}_dispatch_${_target}${_ext}")
+         add_custom_command(OUTPUT "${_out}"
+            COMMAND ${CMAKE_COMMAND} -E copy "${_src}" "${_out}"
+            DEPENDS "${_src}"
+            COMMENT "Copy to ${_out}"
+            WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}"
+            VERBATIM)
+         string(TOLOWER "${_target}" _ns)
+         set_source_files_properties("${_out}" PROPERTIES
+            COMPILE_FLAGS "${ARG_FLAGS} ${_extra_flags}"
+            COMPILE_DEFINITIONS "Vc_DISPATCH_NAMESPACE=dispatch_${_ns}")
+         list(APPEND ${_srcs} "${_out}")
+      else()
+         message(STATUS "vc_compile_for_dispatch: the compiler does not support ${_target}")
+      endif()
+   endforeach()
+   set(${_srcs} "${${_srcs}}" PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,65 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+
+// The kernels are compiled once per Vc::dispatch_target (vc_compile_for_dispatch), each
+// copy with the native_datapar types of its target, and registered with the dispatched
+// objects defined in main.cpp.
+
+#include "kernels.h"
+
+namespace
+{
+using V = Vc::native_datapar<float>;
+
+void saxpy_impl(float a, const float *x, float *y, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + V::size() <= n; i += V::size()) {
+        V yv(y + i, Vc::flags::element_aligned);
+        yv = a * V(x + i, Vc::flags::element_aligned) + yv;
+        yv.memstore(y + i, Vc::flags::element_aligned);
+    }
+    for (; i < n; ++i) {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+float dot_impl(const float *x, const float *y, std::size_t n)
+{
+    V acc = 0;
+    std::size_t i = 0;
+    for (; i + V::size() <= n; i += V::size()) {
+        acc += V(x + i, Vc::flags::element_aligned) * V(y + i, Vc::flags::element_aligned);
+    }
+    float r = Vc::reduce(acc);
+    for (; i < n; ++i) {
+        r += x[i] * y[i];
+    }
+    return r;
+}
+}  // namespace
+
+static const bool saxpy_registered = saxpy.add(&saxpy_impl);
+static const bool dot_registered = dot.add(&dot_impl);
@@ -0,0 +1,38 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+
+#ifndef VC_EXAMPLES_DISPATCH_KERNELS_H_
+#define VC_EXAMPLES_DISPATCH_KERNELS_H_
+
+#include <Vc/datapar>
+#include <cstddef>
+
+// y[i] = a * x[i] + y[i] for i in [0, n)
+extern Vc::dispatched<void(float, const float *, float *, std::size_t)> saxpy;
+
+// returns the sum of x[i] * y[i] for i in [0, n)
+extern Vc::dispatched<float(const float *, const float *, std::size_t)> dot;
+
+#endif  // VC_EXAMPLES_DISPATCH_KERNELS_H_
@@ -0,0 +1,64 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+
+// Calls kernels that were compiled for several instruction sets and reports which one the
+// CPU executes.
+
+#include "kernels.h"
+#include <iostream>
+#include <vector>
+
+Vc::dispatched<void(float, const float *, float *, std::size_t)> saxpy;
+Vc::dispatched<float(const float *, const float *, std::size_t)> dot;
+
+static const char *name(Vc::dispatch_target t)
+{
+    switch (t) {
+    case Vc::dispatch_target::scalar: return "scalar";
+    case Vc::dispatch_target::sse2:   return "SSE2";
+    case Vc::dispatch_target::sse4_2: return "SSE4.2";
+    case Vc::dispatch_target::avx:    return "AVX";
+    case Vc::dispatch_target::avx2:   return "AVX2";
+    case Vc::dispatch_target::avx512: return "AVX-512";
+    }
+    return "unknown";
+}
+
+int main()
+{
+    std::cout << "best target of this CPU: " << name(Vc::best_dispatch_target()) << '\n'
+              << "saxpy runs the " << name(saxpy.selected_target()) << " kernel\n"
+              << "dot runs the " << name(dot.selected_target()) << " kernel\n";
+
+    std::vector<float> x(1000), y(1000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = 0.5f * i;
+        y[i] = 1.f;
+    }
+    saxpy(2.f, x.data(), y.data(), y.size());  // y[i] = i + 1
+    std::cout << "sum of (i + 1) * 0.5i for i < 1000: " << dot(x.data(), y.data(), x.size())
+              << '\n';
+    return 0;
+}
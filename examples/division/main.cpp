@@ -0,0 +1,121 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+// Compares datapar division and modulus of 64-bit integers with a different divisor per
+// element against the scalar loop. Reports cycles per element for quotients of different
+// magnitudes, since the cost of the scalar div instruction depends on them.
+
+#include <Vc/datapar>
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+constexpr std::size_t N = 4096;
+constexpr int Repetitions = 100;
+
+template <class T> struct Data {
+    alignas(64) T n[N];
+    alignas(64) T d[N];
+    alignas(64) T q[N];
+    alignas(64) T r[N];
+};
+
+template <class T> void scalar_divmod(Data<T> &data)
+{
+    for (std::size_t i = 0; i < N; ++i) {
+        data.q[i] = data.n[i] / data.d[i];
+        data.r[i] = data.n[i] % data.d[i];
+    }
+}
+
+template <class T> void datapar_divmod(Data<T> &data)
+{
+    using V = Vc::native_datapar<T>;
+    for (std::size_t i = 0; i < N; i += V::size()) {
+        const V n(&data.n[i], Vc::flags::vector_aligned);
+        const V d(&data.d[i], Vc::flags::vector_aligned);
+        (n / d).memstore(&data.q[i], Vc::flags::vector_aligned);
+        (n % d).memstore(&data.r[i], Vc::flags::vector_aligned);
+    }
+}
+
+// Returns the minimum number of cycles per element.
+template <class F, class T> double benchmark(F &&f, Data<T> &data)
+{
+    unsigned long long best = ~0ull;
+    TimeStampCounter tsc;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        tsc.start();
+        f(data);
+        asm volatile("" ::"m"(data));
+        tsc.stop();
+        best = std::min(best, tsc.cycles());
+    }
+    return double(best) / N;
+}
+
+template <class T> void run(const char *name, int nbits, int dbits)
+{
+    using U = std::make_unsigned_t<T>;
+    std::mt19937_64 rng(nbits * 64 + dbits);
+    auto random = [&](int bits) {
+        const U x = U(rng() >> (64 - bits));
+        return std::is_signed<T>::value && (rng() & 1) ? T(U(0) - x) : T(x);
+    };
+    static Data<T> data;
+    for (std::size_t i = 0; i < N; ++i) {
+        data.n[i] = random(nbits);
+        do {
+            data.d[i] = random(dbits);
+        } while (data.d[i] == 0);
+    }
+
+    const double scalar = benchmark(scalar_divmod<T>, data);
+    std::vector<T> q(data.q, data.q + N);
+    std::vector<T> r(data.r, data.r + N);
+    const double vector = benchmark(datapar_divmod<T>, data);
+    const bool equal =
+        std::equal(q.begin(), q.end(), data.q) && std::equal(r.begin(), r.end(), data.r);
+
+    std::cout << std::setw(8) << name << std::setw(6) << nbits << std::setw(6) << dbits
+              << std::setw(10) << std::fixed << std::setprecision(2) << scalar
+              << std::setw(10) << vector << std::setw(8) << scalar / vector << "x"
+              << (equal ? "" : "  MISMATCH") << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::cout << "datapar size: " << Vc::native_datapar<std::uint64_t>::size() << '\n'
+              << "    type n bits d bits    scalar   datapar speedup  (cycles/element)\n";
+    for (auto bits : {std::make_pair(63, 63), std::make_pair(63, 32), std::make_pair(63, 8),
+                      std::make_pair(32, 16)}) {
+        run<std::uint64_t>("ullong", bits.first, bits.second);
+        run<std::int64_t>("llong", bits.first, bits.second);
+    }
+    return 0;
+}
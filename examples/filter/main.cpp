@@ -0,0 +1,119 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+
+// Selects the values below a threshold (event selection) with a scalar loop, lane by lane
+// via the mask, and with Vc::compress_store. Reports cycles per input element.
+
+#include <Vc/datapar>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+using V = Vc::native_datapar<float>;
+
+constexpr int Repetitions = 10;
+
+std::size_t filter_scalar(const std::vector<float> &in, float cut, float *out)
+{
+    std::size_t n = 0;
+    for (float x : in) {
+        if (x < cut) {
+            out[n++] = x;
+        }
+    }
+    return n;
+}
+
+std::size_t filter_lanes(const std::vector<float> &in, float cut, float *out)
+{
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < in.size(); i += V::size()) {
+        const V x(&in[i], Vc::flags::element_aligned);
+        const auto k = x < cut;
+        for (std::size_t j = 0; j < V::size(); ++j) {
+            if (k[j]) {
+                out[n++] = x[j];
+            }
+        }
+    }
+    return n;
+}
+
+std::size_t filter_compress(const std::vector<float> &in, float cut, float *out)
+{
+    float *const begin = out;
+    for (std::size_t i = 0; i < in.size(); i += V::size()) {
+        const V x(&in[i], Vc::flags::element_aligned);
+        out += Vc::compress_store(x, x < cut, out);
+    }
+    return out - begin;
+}
+
+template <class F>
+double benchmark(F &&f, const std::vector<float> &in, float cut, std::vector<float> &out,
+                 std::size_t &count)
+{
+    unsigned long long best = ~0ull;
+    TimeStampCounter tsc;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        tsc.start();
+        count = f(in, cut, out.data());
+        tsc.stop();
+        best = std::min(best, tsc.cycles());
+    }
+    return double(best) / in.size();
+}
+
+int Vc_CDECL main()
+{
+    constexpr std::size_t N = 1 << 20;  // a multiple of V::size()
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> in(N);
+    for (auto &x : in) {
+        x = dist(rng);
+    }
+    std::vector<float> ref(N), out1(N), out2(N);
+
+    std::cout << "datapar size: " << V::size() << '\n'
+              << "selected    scalar     lanes  compress speedup  (cycles/element)\n";
+    for (float cut : {0.01f, 0.1f, 0.5f, 0.9f, 0.99f}) {
+        std::size_t n0, n1, n2;
+        const double t0 = benchmark(filter_scalar, in, cut, ref, n0);
+        const double t1 = benchmark(filter_lanes, in, cut, out1, n1);
+        const double t2 = benchmark(filter_compress, in, cut, out2, n2);
+        const bool ok = n0 == n1 && n0 == n2 &&
+                        std::equal(ref.begin(), ref.begin() + n0, out1.begin()) &&
+                        std::equal(ref.begin(), ref.begin() + n0, out2.begin());
+        std::cout << std::setw(7) << std::fixed << std::setprecision(0) << cut * 100 << '%'
+                  << std::setprecision(2) << std::setw(10) << t0 << std::setw(10) << t1
+                  << std::setw(10) << t2 << std::setw(7) << std::min(t0, t1) / t2 << 'x'
+                  << (ok ? "" : "  MISMATCH") << '\n';
+    }
+    return 0;
+}
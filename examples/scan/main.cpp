@@ -0,0 +1,87 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+
+// Compares Vc::inclusive_scan with std::partial_sum. Reports cycles per element.
+
+#include <Vc/datapar>
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+constexpr int Repetitions = 10;
+
+// Returns the minimum number of cycles per element.
+template <class F, class T>
+double benchmark(F &&f, const std::vector<T> &input, std::vector<T> &output)
+{
+    unsigned long long best = ~0ull;
+    TimeStampCounter tsc;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        tsc.start();
+        f(input.begin(), input.end(), output.begin());
+        tsc.stop();
+        best = std::min(best, tsc.cycles());
+    }
+    return double(best) / input.size();
+}
+
+template <class T> void run(const char *name, std::size_t n)
+{
+    std::mt19937 rng(n);
+    std::vector<T> input(n);
+    for (auto &x : input) {
+        x = T(rng() % 16);
+    }
+    std::vector<T> ref(n), out(n);
+
+    using It = typename std::vector<T>::const_iterator;
+    using Out = typename std::vector<T>::iterator;
+    const double scalar =
+        benchmark([](It a, It b, Out o) { std::partial_sum(a, b, o); }, input, ref);
+    const double vector =
+        benchmark([](It a, It b, Out o) { Vc::inclusive_scan(a, b, o); }, input, out);
+
+    std::cout << std::setw(8) << name << std::setw(10) << n << std::setw(10) << std::fixed
+              << std::setprecision(2) << scalar << std::setw(10) << vector << std::setw(8)
+              << scalar / vector << "x" << (ref == out ? "" : "  MISMATCH") << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::cout << "datapar size: " << Vc::native_datapar<std::int32_t>::size() << '\n'
+              << "    type         n    scalar  Vc::scan speedup  (cycles/element)\n";
+    for (std::size_t n : {1000, 100000, 1000000}) {
+        run<std::int32_t>("int", n);
+        run<std::int16_t>("short", n);
+        run<float>("float", n);
+        run<double>("double", n);
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*  This file is part of the Vc library.
+
+    Copyright (C) 2017 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+*/
+
+
+// Compares Vc::sort with std::sort on random keys. Reports cycles per element.
+
+#include <Vc/datapar>
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+constexpr int Repetitions = 5;
+
+// Returns the minimum number of cycles per element.
+template <class F, class T> double benchmark(F &&f, const std::vector<T> &input)
+{
+    unsigned long long best = ~0ull;
+    TimeStampCounter tsc;
+    std::vector<T> data;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        data = input;
+        tsc.start();
+        f(data.begin(), data.end());
+        tsc.stop();
+        best = std::min(best, tsc.cycles());
+    }
+    return double(best) / input.size();
+}
+
+template <class T> void run(const char *name, std::size_t n)
+{
+    std::mt19937 rng(n);
+    std::vector<T> input(n);
+    for (auto &x : input) {
+        x = T(rng());
+    }
+
+    using It = typename std::vector<T>::iterator;
+    const double scalar = benchmark([](It a, It b) { std::sort(a, b); }, input);
+    const double vector = benchmark([](It a, It b) { Vc::sort(a, b); }, input);
+
+    std::vector<T> ref = input;
+    std::vector<T> out = input;
+    std::sort(ref.begin(), ref.end());
+    Vc::sort(out.begin(), out.end());
+
+    std::cout << std::setw(8) << name << std::setw(10) << n << std::setw(10) << std::fixed
+              << std::setprecision(2) << scalar << std::setw(10) << vector << std::setw(8)
+              << scalar / vector << "x" << (ref == out ? "" : "  MISMATCH") << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::cout << "datapar size: " << Vc::native_datapar<std::int32_t>::size() << '\n'
+              << "    type         n std::sort  Vc::sort speedup  (cycles/element)\n";
+    for (std::size_t n : {1000, 100000, 1000000, 10000000}) {
+        run<std::int32_t>("int", n);
+        run<std::uint32_t>("uint", n);
+        run<float>("float", n);
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#define WITH_DATAPAR 1
+#include "unittest.h"
+#include <Vc/datapar>
+#include <Vc/Allocator>
+#include <cstdint>
+#include <new>
+#include <numeric>
+#include <vector>
+
+TEST(page_allocator)  //{{{1
+{
+    using V = Vc::native_datapar<float>;
+    using A = Vc::PageAllocator<float>;
+    const std::size_t huge = std::size_t(2) << 20;
+    for (auto pages : {Vc::HugePages::None, Vc::HugePages::Transparent, Vc::HugePages::Reserved}) {
+        for (auto placement : {Vc::NumaPlacement::FirstTouch, Vc::NumaPlacement::Bind,
+                               Vc::NumaPlacement::Interleave}) {
+            const A alloc(pages, placement, 0);
+            COMPARE(alloc, A(Vc::PageAllocator<double>(alloc)));
+            for (std::size_t n : {std::size_t(1), std::size_t(1000), huge / sizeof(float) + 3}) {
+                std::vector<float, A> data(n, 1.f, alloc);
+                const auto addr = reinterpret_cast<std::uintptr_t>(data.data());
+                COMPARE(addr % 4096, 0u);
+#ifdef __linux__
+                if (pages != Vc::HugePages::None && n * sizeof(float) >= huge) {
+                    COMPARE(addr % huge, 0u);
+                }
+#endif
+                if (n >= V::size()) {
+                    COMPARE(V(&data[0], Vc::flags::vector_aligned), V(1.f));
+                }
+                data.back() = 2.f;
+                COMPARE(std::accumulate(data.begin(), data.end(), 0.f), float(n + 1));
+            }
+        }
+    }
+    VERIFY(A(Vc::HugePages::None) != A(Vc::HugePages::Transparent));
+}
+
+TEST(arena)  //{{{1
+{
+    using V = Vc::native_datapar<float>;
+    Vc::arena a(1024);
+    const Vc::pool_allocator<float> alloc(a);
+    COMPARE(alloc, Vc::pool_allocator<float>(Vc::pool_allocator<V>(alloc)));
+    VERIFY(alloc != Vc::pool_allocator<float>());
+    std::vector<char *> first_round;
+    for (int round = 0; round < 2; ++round) {
+        std::vector<char *> ptrs;
+        for (std::size_t n : {1, 3, 100, 1000, 7, 5000, 2}) {
+            std::vector<float, Vc::pool_allocator<float>> data(n, 1.f, alloc);
+            std::vector<V, Vc::pool_allocator<V>> vecs(n, V(2.f), alloc);
+            COMPARE(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(V), 0u);
+            COMPARE(reinterpret_cast<std::uintptr_t>(vecs.data()) % alignof(V), 0u);
+            COMPARE(std::accumulate(data.begin(), data.end(), 0.f), float(n));
+            for (const V &x : vecs) {
+                COMPARE(x, V(2.f));
+            }
+            ptrs.push_back(reinterpret_cast<char *>(data.data()));
+            ptrs.push_back(reinterpret_cast<char *>(vecs.data()));
+        }
+        // after reset the same requests reuse the same memory
+        if (round == 1) {
+            COMPARE(ptrs, first_round);
+        }
+        first_round = ptrs;
+        a.reset();
+    }
+    // allocations bump the pointer by exactly the aligned size
+    char *p = static_cast<char *>(a.allocate(4, 16));
+    COMPARE(static_cast<char *>(a.allocate(16, 16)), p + 16);
+    COMPARE(static_cast<char *>(a.allocate(1, 1)), p + 32);
+}
+
+// requests whose block size would wrap around must throw instead of getting a tiny block
+TEST_CATCH(arena_huge_request, std::bad_alloc)  //{{{1
+{
+    Vc::arena a;
+    a.allocate(std::size_t(-1) - 32, 64);
+}
+
+TEST_CATCH(arena_huge_block_size, std::bad_alloc)  //{{{1
+{
+    Vc::arena a(std::size_t(-1) - 8);
+    a.allocate(1, 1);
+}
+
+// vim: foldmethod=marker
@@ -29,8 +29,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //#define UNITTEST_ONLY_XTEST 1
 #include "unittest.h"
 #include <Vc/datapar>
+#include <Vc/execution>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
 #include "make_vec.h"
 #include "metahelpers.h"
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 template <class... Ts> using base_template = Vc::datapar<Ts...>;
 #include "testtypes.h"
@@ -221,6 +230,11 @@ integral_operators()
         COMPARE(V(2) >> V(1), V(1));
         COMPARE(V(3) >> V(1), V(1));
         COMPARE(V(7) >> V(2), V(1));
+        COMPARE(V(7) >> 2, V(1));
+        const V x([](auto i) -> T { return std::numeric_limits<T>::max() - i; });
+        for (int i = 0; i < int(sizeof(T) * CHAR_BIT); ++i) {
+            COMPARE(x >> i, x >> V(i)) << "i: " << i;
+        }
     }
 
     //}}}2
@@ -1436,6 +1450,832 @@ TEST_TYPES(V, algorithms, ALL_TYPES)  //{{{1
     COMPARE(max(a, b), V{1});
 }
 
+template <class V> void split_concat_halves(const V &, std::false_type) {}  //{{{1
+template <class V> void split_concat_halves(const V &x, std::true_type)
+{
+    using T = typename V::value_type;
+    using H = Vc::datapar<T, Vc::abi_for_size_t<T, V::size() / 2>>;
+    const auto halves = Vc::split<H>(x);
+    COMPARE(halves.size(), 2u);
+    for (std::size_t i = 0; i < H::size(); ++i) {
+        COMPARE(halves[0][i], x[i]) << "i: " << i;
+        COMPARE(halves[1][i], x[i + H::size()]) << "i: " << i;
+    }
+    const auto y = Vc::concat(halves[0], halves[1]);
+    COMPARE(y.size(), V::size());
+    COMPARE((std::is_same<decltype(y), const Vc::datapar<T, Vc::abi_for_size_t<T, V::size()>>>::value),
+            true);
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(y[i], x[i]) << "i: " << i;
+    }
+    using S = Vc::datapar<T, Vc::datapar_abi::scalar>;
+    const auto z = Vc::concat(S(x[1]), S(x[0]), S(x[1]));
+    COMPARE(z.size(), 3u);
+    COMPARE(z[0], x[1]);
+    COMPARE(z[1], x[0]);
+    COMPARE(z[2], x[1]);
+}
+
+TEST_TYPES(V, split_concat, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    const V x([](auto i) -> T { return i + 1; });
+    split_concat_halves(x, std::integral_constant<bool, V::size() % 2 == 0>());
+
+    using S = Vc::datapar<T, Vc::datapar_abi::scalar>;
+    const auto scalars = Vc::split<S>(x);
+    COMPARE(scalars.size(), V::size());
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(scalars[i][0], x[i]) << "i: " << i;
+    }
+}
+
+template <class V, size_t... I> V permute_reversed(const V &x, std::index_sequence<I...>)  //{{{1
+{
+    return Vc::permute<int(V::size() - 1 - I)...>(x);
+}
+template <class V, size_t... I> V permute_rotated(const V &x, std::index_sequence<I...>)
+{
+    return Vc::permute<int((I + 1) % V::size())...>(x);
+}
+template <class V, size_t... I> V permute_broadcast(const V &x, std::index_sequence<I...>)
+{
+    return Vc::permute<int(0 * I + V::size() / 2)...>(x);
+}
+template <class V, size_t... I> V permute_pairs(const V &x, std::index_sequence<I...>)
+{
+    return Vc::permute<int(I ^ (V::size() % 2 == 0 ? 1 : 0))...>(x);
+}
+template <class V, size_t... I> V permute_in_quads(const V &x, std::index_sequence<I...>)
+{
+    return Vc::permute<int(I ^ (V::size() % 4 == 0 ? 2 : 0))...>(x);
+}
+
+TEST_TYPES(V, permute, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    constexpr std::size_t N = V::size();
+    const auto seq = std::make_index_sequence<N>();
+    const V x([](auto i) -> T { return i + 1; });
+
+    const V reversed = permute_reversed(x, seq);
+    const V rotated = permute_rotated(x, seq);
+    const V broadcast = permute_broadcast(x, seq);
+    const V pairs = permute_pairs(x, seq);
+    const V quads = permute_in_quads(x, seq);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(reversed[i], x[N - 1 - i]) << "i: " << i;
+        COMPARE(rotated[i], x[(i + 1) % N]) << "i: " << i;
+        COMPARE(broadcast[i], x[N / 2]) << "i: " << i;
+        COMPARE(pairs[i], x[i ^ (N % 2 == 0 ? 1 : 0)]) << "i: " << i;
+        COMPARE(quads[i], x[i ^ (N % 4 == 0 ? 2 : 0)]) << "i: " << i;
+    }
+
+    using I = std::conditional_t<
+        sizeof(T) == 1, schar,
+        std::conditional_t<sizeof(T) == 2, short,
+                           std::conditional_t<sizeof(T) == 4, int, long long>>>;
+    using IV = Vc::datapar<I, Vc::abi_for_size_t<I, N>>;
+    const IV idx_reversed([](auto i) -> I { return N - 1 - i; });
+    COMPARE(Vc::permute(x, idx_reversed), reversed);
+    const IV idx_scattered([](auto i) -> I { return (i * 3 + 1) % N; });
+    const V scattered = Vc::permute(x, idx_scattered);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(scattered[i], x[(i * 3 + 1) % N]) << "i: " << i;
+    }
+    COMPARE(Vc::permute(x, IV(0)), V(x[0]));
+}
+
+template <class V> void divisor_check(const V &n, typename V::value_type d)  //{{{1
+{
+    using T = typename V::value_type;
+    const Vc::divisor<V> dd(d);
+    COMPARE(dd.value(), d);
+    const V q = n / dd;
+    const V r = n % dd;
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(q[i], T(n[i] / d)) << "n: " << +n[i] << ", d: " << +d;
+        COMPARE(r[i], T(n[i] % d)) << "n: " << +n[i] << ", d: " << +d;
+    }
+}
+
+template <class V>
+std::enable_if_t<std::is_integral<typename V::value_type>::value, void> divisor_tests()
+{
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    // the offsets are reduced below 100, such that they fit into schar and uchar
+    const V small([](auto i) -> T { return T((std::size_t(i) * 7 + 1) % 100); });
+    const V large([](auto i) -> T { return limits::max() - T(std::size_t(i) * 11 % 100); });
+    const V low([](auto i) -> T { return limits::min() + T(std::size_t(i) * 13 % 100); });
+    for (T d : {T(1), T(2), T(3), T(7), T(10), T(64), T(100), T(127), T(limits::max() / 3),
+                T(limits::max() - 1), limits::max()}) {
+        divisor_check(small, d);
+        divisor_check(large, d);
+        divisor_check(low, d);
+        if (std::is_signed<T>::value) {
+            divisor_check(-small, d);
+            divisor_check(small, T(-d));
+            divisor_check(-small, T(-d));
+            divisor_check(large, T(-d));
+            if (d != 1) {
+                divisor_check(low, T(-d));
+            }
+        }
+    }
+    if (std::is_signed<T>::value) {
+        divisor_check(small, limits::min());
+        divisor_check(low, limits::min());
+    }
+
+    V x = large;
+    x /= Vc::divisor<V>(3);
+    COMPARE(x, large / 3);
+    x = large;
+    x %= Vc::divisor<V>(3);
+    COMPARE(x, large % 3);
+}
+
+template <class V>
+std::enable_if_t<!std::is_integral<typename V::value_type>::value, void> divisor_tests()
+{
+}
+
+TEST_TYPES(V, divisor, ALL_TYPES)  //{{{1
+{
+    divisor_tests<V>();
+}
+
+template <class V> void varying_divisor_check(const V &n, V d)  //{{{1
+{
+    using T = typename V::value_type;
+    if (std::is_signed<T>::value) {
+        // min / -1 overflows
+        where(n == std::numeric_limits<T>::min() && d == T(-1), d) = 1;
+    }
+    const V q = n / d;
+    const V r = n % d;
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(q[i], T(n[i] / d[i])) << "n: " << +n[i] << ", d: " << +d[i];
+        COMPARE(r[i], T(n[i] % d[i])) << "n: " << +n[i] << ", d: " << +d[i];
+    }
+}
+
+template <class V>
+std::enable_if_t<std::is_integral<typename V::value_type>::value, void>
+varying_divisor_tests()
+{
+    using T = typename V::value_type;
+    using U = std::make_unsigned_t<T>;
+    using limits = std::numeric_limits<T>;
+    constexpr int digits = std::numeric_limits<U>::digits;
+    // pseudo-random bit patterns of all lengths cover small and large quotients
+    U state = U(0x9e3779b97f4a7c15ull);
+    auto random = [&](int bits) {
+        state = U(state * U(6364136223846793005ull) + 1u);
+        const U x = U(state ^ (state >> (digits / 2)));
+        return bits >= digits ? T(x) : T(x & U((U(1) << bits) - 1u));
+    };
+    for (int i = 0; i < 200; ++i) {
+        const int nbits = 1 + i % digits;
+        const int dbits = 1 + (i * 7) % digits;
+        V n([&](auto) { return random(nbits); });
+        V d([&](auto) { return random(dbits); });
+        where(d == 0, d) = 1;
+        varying_divisor_check(n, d);
+        if (std::is_signed<T>::value) {
+            where(n == limits::min(), n) = limits::max();
+            where(d == limits::min(), d) = limits::max();
+            varying_divisor_check(V(-n), d);
+            varying_divisor_check(n, V(-d));
+            varying_divisor_check(V(-n), V(-d));
+        }
+    }
+
+    const V n = make_vec<V>({limits::max(), limits::min(), T(limits::max() - 1),
+                             T(limits::min() + 1), T(0), T(1)});
+    varying_divisor_check(n, V(1));
+    varying_divisor_check(n, V(limits::max()));
+    varying_divisor_check(n, V(n | V(1)));
+    varying_divisor_check(n, make_vec<V>({T(1), T(2), T(3), limits::max(), T(7)}));
+    if (std::is_signed<T>::value) {
+        varying_divisor_check(n, V(limits::min()));
+        varying_divisor_check(n, V(T(-1)));
+        varying_divisor_check(n, make_vec<V>({T(-2), T(2), T(-3), T(3), limits::min()}));
+    }
+}
+
+template <class V>
+std::enable_if_t<!std::is_integral<typename V::value_type>::value, void>
+varying_divisor_tests()
+{
+}
+
+TEST_TYPES(V, varying_divisor, ALL_TYPES)  //{{{1
+{
+    varying_divisor_tests<V>();
+}
+
+TEST_TYPES(V, sorted, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    const V ascending([](auto i) -> T { return T(i); });
+    COMPARE(Vc::sorted(ascending), ascending);
+    const V descending([](auto i) -> T { return T(V::size() - 1 - i); });
+    COMPARE(Vc::sorted(descending), ascending);
+    COMPARE(Vc::sorted(V(1)), V(1));
+
+    unsigned state = 1;
+    for (int n = 0; n < 100; ++n) {
+        // few distinct values, to test duplicates
+        const V x([&](auto) -> T {
+            state = state * 1103515245u + 12345u;
+            return T((state >> 16) % 23);
+        });
+        std::array<T, V::size()> ref;
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            ref[i] = x[i];
+        }
+        std::sort(ref.begin(), ref.end());
+        const V s = Vc::sorted(x);
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            COMPARE(s[i], ref[i]) << "x: " << x << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, sort_range, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    unsigned state = 7;
+    for (int n : {0, 1, 2, 3, int(V::size()), int(V::size() * 2 - 1), int(V::size() * 5 + 3),
+                  256, 1000, 4099}) {
+        std::vector<T> data(n);
+        for (auto &x : data) {
+            state = state * 1103515245u + 12345u;
+            x = T(state >> 16);
+        }
+        std::vector<T> ref = data;
+        std::sort(ref.begin(), ref.end());
+        Vc::sort(data.begin(), data.end());
+        COMPARE(data == ref, true) << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, compress_expand, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    using M = typename V::mask_type;
+    const V x([](auto i) -> T { return T(i + 1); });
+    unsigned state = 3;
+    for (int n = 0; n < 200; ++n) {
+        const M k = n == 0 ? M(false) : n == 1 ? M(true) : V([&](auto) -> T {
+            state = state * 1103515245u + 12345u;
+            return T((state >> 16) & 1);
+        }) == V(1);
+        std::array<T, V::size() + 1> mem;
+        mem.fill(T(-1));
+        const std::size_t count = Vc::compress_store(x, k, mem.data());
+        COMPARE(count, std::size_t(popcount(k))) << "k: " << k;
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            if (k[i]) {
+                COMPARE(mem[j], x[i]) << "k: " << k << ", i: " << i;
+                ++j;
+            }
+        }
+        for (; j < mem.size(); ++j) {
+            COMPARE(mem[j], T(-1)) << "k: " << k << ", j: " << j;
+        }
+
+        V y(T(-2));
+        COMPARE(Vc::expand_load(mem.data(), k, y), count) << "k: " << k;
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            COMPARE(y[i], k[i] ? x[i] : T(-2)) << "k: " << k << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, scan, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    const auto max_op = [](const auto &a, const auto &b) {
+        using std::max;
+        return max(a, b);
+    };
+    unsigned state = 5;
+    for (int n = 0; n < 50; ++n) {
+        // small values, such that the sum of all entries does not overflow
+        const V x([&](auto) -> T {
+            state = state * 1103515245u + 12345u;
+            return T((state >> 16) % 2);
+        });
+        const V y([&](auto) -> T {
+            state = state * 1103515245u + 12345u;
+            return T((state >> 16) % 100);
+        });
+        const V sum = Vc::inclusive_scan(x);
+        const V exsum = Vc::exclusive_scan(x);
+        const V exsum3 = Vc::exclusive_scan(x, std::plus<>(), T(3));
+        const V running_max = Vc::inclusive_scan(y, max_op);
+        T s = 0;
+        T m = y[0];
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            COMPARE(exsum[i], s) << "x: " << x << ", i: " << i;
+            COMPARE(exsum3[i], T(s + 3)) << "x: " << x << ", i: " << i;
+            s += x[i];
+            COMPARE(sum[i], s) << "x: " << x << ", i: " << i;
+            m = std::max<T>(m, y[i]);
+            COMPARE(running_max[i], m) << "y: " << y << ", i: " << i;
+        }
+    }
+    COMPARE(Vc::inclusive_scan(V(1), std::multiplies<>()), V(1));
+    COMPARE(Vc::exclusive_scan(V(1), std::multiplies<>()), V(1));
+}
+
+TEST_TYPES(V, scan_range, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    unsigned state = 11;
+    for (int n : {0, 1, 2, 3, int(V::size()), int(V::size() * 2 - 1), int(V::size() * 5 + 3),
+                  256, 1000}) {
+        std::vector<T> data(n);
+        for (auto &x : data) {
+            state = state * 1103515245u + 12345u;
+            x = T((state >> 16) % 2);
+        }
+        std::vector<T> ref(n);
+        for (int i = 0; i < n; ++i) {
+            ref[i] = i == 0 ? data[0] : T(ref[i - 1] + data[i]);
+        }
+        std::vector<T> out(n);
+        COMPARE(Vc::inclusive_scan(data.begin(), data.end(), out.begin()) == out.end(), true);
+        COMPARE(out == ref, true) << "n: " << n;
+        // in place
+        Vc::inclusive_scan(data.begin(), data.end(), data.begin());
+        COMPARE(data == ref, true) << "n: " << n;
+    }
+}
+
+template <class V>  //{{{1
+std::enable_if_t<std::is_integral<typename V::value_type>::value &&
+                     (sizeof(typename V::value_type) <= 2),
+                 void>
+saturating_tests()
+{
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    const auto clamp = [](int x) -> T {
+        return T(std::min(std::max(x, int(limits::min())), int(limits::max())));
+    };
+    unsigned state = 7;
+    const auto next = [&](auto) -> T {
+        state = state * 1103515245u + 12345u;
+        switch ((state >> 8) % 4) {
+        case 0: return limits::min() + T((state >> 16) % 4);
+        case 1: return limits::max() - T((state >> 16) % 4);
+        default: return T(state >> 16);
+        }
+    };
+    for (int n = 0; n < 100; ++n) {
+        const V x(next);
+        const V y(next);
+        const V sum = Vc::add_sat(x, y);
+        const V diff = Vc::sub_sat(x, y);
+        const V mean = Vc::avg(x, y);
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            COMPARE(sum[i], clamp(int(x[i]) + int(y[i]))) << "x: " << x << ", y: " << y;
+            COMPARE(diff[i], clamp(int(x[i]) - int(y[i]))) << "x: " << x << ", y: " << y;
+            COMPARE(mean[i], T((int(x[i]) + int(y[i]) + 1) >> 1))
+                << "x: " << x << ", y: " << y;
+        }
+    }
+    COMPARE(Vc::add_sat(V(limits::max()), V(1)), V(limits::max()));
+    COMPARE(Vc::sub_sat(V(limits::min()), V(1)), V(limits::min()));
+    COMPARE(Vc::avg(V(limits::max()), V(limits::max())), V(limits::max()));
+}
+
+template <class V>
+std::enable_if_t<!std::is_integral<typename V::value_type>::value ||
+                     (sizeof(typename V::value_type) > 2),
+                 void>
+saturating_tests()
+{
+}
+
+TEST_TYPES(V, saturating, ALL_TYPES)  //{{{1
+{
+    saturating_tests<V>();
+}
+
+template <class U, class T> U saturated_reference(T x)  //{{{1
+{
+    using L = std::numeric_limits<U>;
+    return std::is_signed<T>::value && x < T()
+               ? (std::is_signed<U>::value && llong(x) >= llong(L::min()) ? U(x) : L::min())
+               : (ullong(x) <= ullong(L::max()) ? U(x) : L::max());
+}
+
+// Casts from two arguments, if a datapar type with 2 * V::size() entries exists.
+template <class U, class V,
+          class = std::enable_if_t<(2 * V::size() <= Vc::datapar_abi::max_fixed_size ||
+                                    2 * V::size() == Vc::native_datapar<U>::size())>>
+void saturated_cast_check(const V &a, const V &b, int)
+{
+    using W = Vc::datapar<U, Vc::abi_for_size_t<U, 2 * V::size()>>;
+    const W w = Vc::saturated_datapar_cast<W>(a, b);
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(w[i], saturated_reference<U>(a[i]))
+            << "a: " << a << ", U: " << typeToString<U>();
+        COMPARE(w[i + V::size()], saturated_reference<U>(b[i]))
+            << "b: " << b << ", U: " << typeToString<U>();
+    }
+}
+template <class U, class V> void saturated_cast_check(const V &, const V &, float) {}
+
+template <class U, class V> void saturated_cast_check(const V &a, const V &b)
+{
+    using H = Vc::datapar<U, Vc::abi_for_size_t<U, V::size()>>;
+    const H h = Vc::saturated_datapar_cast<H>(a);
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(h[i], saturated_reference<U>(a[i]))
+            << "a: " << a << ", U: " << typeToString<U>();
+    }
+    saturated_cast_check<U>(a, b, 0);
+}
+
+template <class V>
+std::enable_if_t<std::is_integral<typename V::value_type>::value, void>
+saturated_cast_tests()
+{
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    unsigned state = 3;
+    const auto next = [&](auto) -> T {
+        state = state * 1103515245u + 12345u;
+        const ullong r = ullong(state >> 4) * (state >> 12);
+        switch ((state >> 8) % 4) {
+        case 0: return T(r % 300);
+        case 1: return T(T(0) - T(r % 70000));
+        case 2: return T(r);
+        default: return (state >> 16) % 2 ? limits::max() : limits::min();
+        }
+    };
+    for (int n = 0; n < 50; ++n) {
+        const V a(next);
+        const V b(next);
+        saturated_cast_check<schar>(a, b);
+        saturated_cast_check<uchar>(a, b);
+        saturated_cast_check<short>(a, b);
+        saturated_cast_check<ushort>(a, b);
+        saturated_cast_check<int>(a, b);
+        saturated_cast_check<uint>(a, b);
+    }
+}
+
+template <class V>
+std::enable_if_t<!std::is_integral<typename V::value_type>::value, void>
+saturated_cast_tests()
+{
+}
+
+TEST_TYPES(V, saturated_cast, ALL_TYPES)  //{{{1
+{
+    saturated_cast_tests<V>();
+}
+
+template <class V>
+std::enable_if_t<std::is_same<typename V::value_type, float>::value, void>
+float16_tests()
+{
+    using Vc::detail::ushort;
+    using Vc::detail::float_bits;
+    constexpr std::size_t N = V::size();
+    alignas(Vc::memory_alignment_v<V, Vc::half>) Vc::half h[N];
+    alignas(Vc::memory_alignment_v<V, Vc::bfloat16>) Vc::bfloat16 b[N];
+
+    // every half and bfloat16 value converts to float and back unchanged (NaNs stay NaN)
+    for (unsigned start = 0; start < 0x10000; start += N) {
+        for (std::size_t i = 0; i < N; ++i) {
+            h[i] = Vc::half::from_bits(ushort(start + i));
+            b[i] = Vc::bfloat16::from_bits(ushort(start + i));
+        }
+        V x(h, Vc::flags::vector_aligned);
+        V y(b, Vc::flags::element_aligned);
+        for (std::size_t i = 0; i < N; ++i) {
+            const float hf = Vc::detail::half_to_float(ushort(start + i));
+            const float bf = Vc::detail::bfloat16_to_float(ushort(start + i));
+            if (std::isnan(hf)) {  // F16C sets the quiet bit of signaling NaNs
+                VERIFY(std::isnan(x[i])) << "half bits: " << start + i;
+            } else {
+                COMPARE(float_bits(x[i]), float_bits(hf)) << "half bits: " << start + i;
+            }
+            COMPARE(float_bits(y[i]), float_bits(bf)) << "bfloat16 bits: " << start + i;
+        }
+        x.memstore(h, Vc::flags::element_aligned);
+        y.memstore(b, Vc::flags::vector_aligned);
+        for (std::size_t i = 0; i < N; ++i) {
+            const ushort bits = start + i;
+            if ((bits & 0x7c00) == 0x7c00 && (bits & 0x3ff) != 0) {
+                COMPARE(h[i].bits() & 0x7c00, 0x7c00) << "half NaN: " << bits;
+                VERIFY((h[i].bits() & 0x3ff) != 0) << "half NaN: " << bits;
+            } else {
+                COMPARE(h[i].bits(), bits);
+            }
+            if ((bits & 0x7f80) == 0x7f80 && (bits & 0x7f) != 0) {
+                COMPARE(b[i].bits(), bits | 0x40);
+            } else {
+                COMPARE(b[i].bits(), bits);
+            }
+        }
+    }
+
+    // rounding to nearest, ties to even, overflow, and subnormals (2^-24, 2^-25, 3 * 2^-25,
+    // and the tie between the largest subnormal half and the smallest normal one)
+    const float inputs[] = {1.f,
+                            -2.f,
+                            65504.f,
+                            65519.f,
+                            65520.f,
+                            -1e10f,
+                            5.9604645e-8f,
+                            2.9802322e-8f,
+                            8.9406967e-8f,
+                            6.1005354e-5f,
+                            1.00048828125f,
+                            1.00146484375f,
+                            1.0039215087890625f,
+                            1.01171875f,
+                            1.00390625f,
+                            0.f};
+    const ushort expected_half[] = {0x3c00, 0xc000, 0x7bff, 0x7bff, 0x7c00, 0xfc00,
+                                    0x0001, 0x0000, 0x0002, 0x0400, 0x3c00, 0x3c02,
+                                    0x3c04, 0x3c0c, 0x3c04, 0x0000};
+    const ushort expected_bfloat16[] = {0x3f80, 0xc000, 0x4780, 0x4780, 0x4780, 0xd015,
+                                        0x3380, 0x3300, 0x33c0, 0x3880, 0x3f80, 0x3f80,
+                                        0x3f81, 0x3f82, 0x3f80, 0x0000};
+    for (std::size_t start = 0; start < 16; start += N) {
+        const V x([&](auto i) { return inputs[(start + i) % 16]; });
+        x.memstore(h, Vc::flags::element_aligned);
+        x.memstore(b, Vc::flags::element_aligned);
+        for (std::size_t i = 0; i < N; ++i) {
+            COMPARE(h[i].bits(), expected_half[(start + i) % 16]) << "x: " << x;
+            COMPARE(b[i].bits(), expected_bfloat16[(start + i) % 16]) << "x: " << x;
+        }
+    }
+}
+
+template <class V>
+std::enable_if_t<!std::is_same<typename V::value_type, float>::value, void>
+float16_tests()
+{
+}
+
+TEST_TYPES(V, float16, ALL_TYPES)  //{{{1
+{
+    float16_tests<V>();
+}
+
+TEST_TYPES(V, range_algorithms, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    constexpr std::size_t N = Vc::native_datapar<T>::size();
+    for (std::size_t offset = 0; offset < 3; ++offset) {
+        for (std::size_t n = 0; n < 3 * N + 2; ++n) {
+            std::vector<T> a(n + offset), b(n + offset), c(n + offset);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                a[i] = T(i % 7);
+                b[i] = T(i % 5 + 1);
+            }
+            T *const x = a.data() + offset;
+            T *const y = b.data() + offset;
+            T *const z = c.data() + offset;
+
+            std::size_t visited = 0;
+            Vc::for_each(x, x + n, [&](auto &v) {
+                visited += v.size();
+                v += 1;
+            });
+            COMPARE(visited, n);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(x[i], T((i + offset) % 7 + 1)) << "n: " << n << ", i: " << i;
+            }
+
+            COMPARE(Vc::transform(x, x + n, z, [](auto v) { return v * 2; }), z + n);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(z[i], T(x[i] * 2)) << "n: " << n << ", i: " << i;
+            }
+            Vc::transform(x, x + n, y, z, [](auto v, auto w) { return v + w; });
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(z[i], T(x[i] + y[i])) << "n: " << n << ", i: " << i;
+            }
+
+            T sum = 0, inner = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += x[i];
+                inner += T(x[i] * y[i]);
+            }
+            COMPARE(Vc::transform_reduce(x, x + n, T(1), std::plus<>(),
+                                         [](auto v) { return v; }),
+                    T(sum + 1))
+                << "n: " << n;
+            COMPARE(Vc::transform_reduce(x, x + n, y, T(0)), inner) << "n: " << n;
+        }
+    }
+}
+
+TEST_TYPES(V, par_simd, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    // small chunks, so that the ranges are split over many chunks and threads
+    const Vc::execution::parallel_simd_policy policy{256};
+    for (std::size_t offset = 0; offset < 3; ++offset) {
+        for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(1000), std::size_t(4099)}) {
+            std::vector<T> a(n + offset), b(n + offset), c(n + offset);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                a[i] = T(i % 7);
+                b[i] = T(i % 5 + 1);
+            }
+            T *const x = a.data() + offset;
+            T *const y = b.data() + offset;
+            T *const z = c.data() + offset;
+
+            std::atomic<std::size_t> visited(0);
+            Vc::for_each(policy, x, x + n, [&](auto &v) {
+                visited += v.size();
+                v += 1;
+            });
+            COMPARE(visited.load(), n);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(x[i], T((i + offset) % 7 + 1)) << "n: " << n << ", i: " << i;
+            }
+
+            COMPARE(Vc::transform(policy, x, x + n, z, [](auto v) { return v * 2; }), z + n);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(z[i], T(x[i] * 2)) << "n: " << n << ", i: " << i;
+            }
+            Vc::transform(policy, x, x + n, y, z, [](auto v, auto w) { return v + w; });
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(z[i], T(x[i] + y[i])) << "n: " << n << ", i: " << i;
+            }
+
+            const T sum = Vc::reduce(x, x + n, T(1));
+            const T inner = Vc::transform_reduce(x, x + n, y, T(0));
+            for (int repeat = 0; repeat < 3; ++repeat) {
+                COMPARE(Vc::reduce(policy, x, x + n, T(1)), sum) << "n: " << n;
+                COMPARE(Vc::transform_reduce(policy, x, x + n, y, T(0)), inner) << "n: " << n;
+                COMPARE(Vc::transform_reduce(policy, x, x + n, T(0), std::plus<>(),
+                                             [](auto v) { return v * 2; }),
+                        Vc::transform_reduce(x, x + n, T(0), std::plus<>(),
+                                             [](auto v) { return v * 2; }))
+                    << "n: " << n;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, streaming_prefetch, ALL_TYPES)  //{{{1
+{
+    using T = typename V::value_type;
+    constexpr std::size_t A = Vc::memory_alignment_v<V>;
+    alignas(A > alignof(std::max_align_t) ? A : alignof(std::max_align_t)) T mem[4 * V::size()];
+    for (std::size_t i = 0; i < 4 * V::size(); ++i) {
+        mem[i] = T(i & 0x3f);
+    }
+    const V ref([](auto i) { return T(i & 0x3f); });
+
+    V x(mem, Vc::flags::streaming);
+    COMPARE(x, ref);
+    x.memload(&mem[V::size()], Vc::flags::streaming);
+    COMPARE(x, V([](auto i) { return T((i + V::size()) & 0x3f); }));
+    x.memstore(&mem[2 * V::size()], Vc::flags::streaming);
+    Vc::streaming_fence();
+    COMPARE(V(&mem[2 * V::size()], Vc::flags::vector_aligned), x);
+
+    // prefetches are hints and must not change the result
+    COMPARE(V(mem, Vc::flags::prefetch<256>), ref);
+    COMPARE(V(&mem[1], Vc::flags::element_aligned | Vc::flags::prefetch<64, 0>),
+            V([](auto i) { return T((i + 1) & 0x3f); }));
+    COMPARE(V(mem, Vc::flags::vector_aligned | Vc::flags::prefetch<512, 2>), ref);
+    COMPARE(V(mem, Vc::flags::prefetch<1024, 3> | Vc::flags::streaming), ref);
+    ref.memstore(&mem[3 * V::size()], Vc::flags::streaming | Vc::flags::prefetch<128>);
+    ref.memstore(&mem[1], Vc::flags::prefetch<128>);
+    Vc::streaming_fence();
+    COMPARE(V(&mem[3 * V::size()], Vc::flags::vector_aligned), ref);
+    COMPARE(V(&mem[1], Vc::flags::element_aligned), ref);
+
+    // with conversion the streaming flag falls back to vector-aligned accesses
+    using I = Vc::datapar<int, Vc::abi_for_size_t<int, V::size()>>;
+    alignas(Vc::memory_alignment_v<V, int> > alignof(std::max_align_t)
+                ? Vc::memory_alignment_v<V, int>
+                : alignof(std::max_align_t)) int imem[V::size()];
+    ref.memstore(imem, Vc::flags::streaming);
+    COMPARE(I(imem, Vc::flags::vector_aligned), I([](auto i) { return int(i & 0x3f); }));
+    COMPARE(V(imem, Vc::flags::streaming), ref);
+}
+
+TEST_TYPES(V, masked_tail, ALL_TYPES)  //{{{1
+{
+#ifdef __linux__
+    using T = typename V::value_type;
+    // the entries following the last element lie on an inaccessible page
+    const std::size_t page = sysconf(_SC_PAGESIZE);
+    char *mem = static_cast<char *>(mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE,
+                                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    VERIFY(mem != MAP_FAILED);
+    COMPARE(mprotect(mem + page, page, PROT_NONE), 0);
+    const V iota([](auto i) { return T(i); });
+    for (std::size_t n = 0; n <= V::size(); ++n) {
+        T *data = reinterpret_cast<T *>(mem + page) - n;
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = T(i + 1);
+        }
+        const auto k = iota < T(n);
+        V x = T(100);
+        where(k, x).memload(data, Vc::flags::element_aligned);
+        COMPARE(x, V([&](auto i) { return i < n ? T(i + 1) : T(100); })) << "n = " << n;
+        x += T(1);
+        where(k, x).memstore(data, Vc::flags::element_aligned);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(data[i], T(i + 2)) << "n = " << n;
+        }
+    }
+    munmap(mem, 2 * page);
+#endif
+}
+
+template <class T, int N> void fixed_size_chunks_test()
+{
+    using V = Vc::fixed_size_datapar<T, N>;
+    using M = typename V::mask_type;
+    const V iota([](auto i) { return T(i); });
+
+    // element access in the chunks and in the rest
+    V x = T(0);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(iota[i], T(i)) << "N = " << N;
+        x[i] = T(N - i);
+    }
+    for (int i = 0; i < N; ++i) {
+        COMPARE(x[i], T(N - i)) << "N = " << N;
+    }
+
+    // loads and stores across the chunk boundaries
+    T mem[N + 1] = {};
+    x.memstore(&mem[1], Vc::flags::element_aligned);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(mem[i + 1], T(N - i)) << "N = " << N;
+    }
+    COMPARE(V(&mem[1], Vc::flags::element_aligned), x) << "N = " << N;
+
+    // conversions to fixed_size types with a different chunk layout and back
+    const Vc::fixed_size_datapar<int, N> xi(x);
+    const Vc::fixed_size_datapar<double, N> xd(x);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(xi[i], N - i) << "N = " << N;
+        COMPARE(xd[i], double(N - i)) << "N = " << N;
+    }
+    COMPARE(V(xi), x) << "N = " << N;
+    COMPARE(V(xd), x) << "N = " << N;
+
+    // masks
+    const M k = iota < T(N / 2);
+    M k2(false);
+    for (int i = 0; i < N; ++i) {
+        COMPARE(k[i], i < N / 2) << "N = " << N;
+        k2[i] = i % 3 == 0;
+    }
+    for (int i = 0; i < N; ++i) {
+        COMPARE(k2[i], i % 3 == 0) << "N = " << N;
+    }
+    COMPARE(popcount(k2), (N + 2) / 3) << "N = " << N;
+    COMPARE(find_first_set(!k), N / 2) << "N = " << N;
+    COMPARE(find_last_set(k), N / 2 - 1) << "N = " << N;
+    const typename Vc::fixed_size_datapar<int, N>::mask_type ki = k;
+    const typename Vc::fixed_size_datapar<double, N>::mask_type kd = k2;
+    for (int i = 0; i < N; ++i) {
+        COMPARE(ki[i], i < N / 2) << "N = " << N;
+        COMPARE(kd[i], i % 3 == 0) << "N = " << N;
+    }
+    where(k, x) = iota;
+    for (int i = 0; i < N; ++i) {
+        COMPARE(x[i], i < N / 2 ? T(i) : T(N - i)) << "N = " << N;
+    }
+}
+
+TEST_TYPES(T, fixed_size_chunks, (TESTTYPES))  //{{{1
+{
+    // sizes that are no multiple of the native widths, thus with a non-empty rest
+    fixed_size_chunks_test<T, 5>();
+    fixed_size_chunks_test<T, 7>();
+    fixed_size_chunks_test<T, 9>();
+    fixed_size_chunks_test<T, 12>();
+    fixed_size_chunks_test<T, 13>();
+    fixed_size_chunks_test<T, 17>();
+    fixed_size_chunks_test<T, 20>();
+    fixed_size_chunks_test<T, 31>();
+}
+
 //}}}1
 
 // vim: foldmethod=marker
@@ -0,0 +1,387 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#define WITH_DATAPAR 1
+//#define UNITTEST_ONLY_XTEST 1
+#include "unittest.h"
+#include <Vc/datapar>
+#include <random>
+
+template <class... Ts> using base_template = Vc::datapar<Ts...>;
+#include "testtypes.h"
+
+// real_test_types {{{1
+template <class L> struct filter_real;
+template <class... Vs> struct filter_real<Typelist<Vs...>> {
+    using type = concat<std::conditional_t<
+        std::is_floating_point<typename Vs::value_type>::value, Typelist<Vs>, Typelist<>>...>;
+};
+using real_test_types = typename filter_real<all_test_types>::type;
+
+// helpers {{{1
+// Returns a vector with the entries start, start + step, start + 2 * step, ...
+template <class V>
+V iota(typename V::value_type start, typename V::value_type step)
+{
+    using T = typename V::value_type;
+    return V([&](auto i) { return T(start + T(i) * step); });
+}
+
+// Applies the standard library function f to each entry of x
+template <class V, class F> V apply_std(const V &x, F &&f)
+{
+    using T = typename V::value_type;
+    return V([&](auto i) { return T(f(T(x[i]))); });
+}
+
+template <class V, class F> V apply_std(const V &x, const V &y, F &&f)
+{
+    using T = typename V::value_type;
+    return V([&](auto i) { return T(f(T(x[i]), T(y[i]))); });
+}
+
+template <class T> std::vector<T> special_values()
+{
+    using L = std::numeric_limits<T>;
+    return {T(0),       T(-0.),        T(1),         T(-1),         L::infinity(),
+            -L::infinity(), L::quiet_NaN(), L::min(),      -L::min(),     L::max(),
+            -L::max()};
+}
+
+TEST_TYPES(V, sincos, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    // the range reduction loses precision for large inputs, so test a range where the
+    // kernels are expected to be (nearly) correctly rounded
+    const T limit = std::is_same<T, float>::value ? 8192 : 1 << 20;
+    const T step = limit / 4096 / V::size();
+    for (T start = -limit; start < limit; start += step * V::size()) {
+        const V x = iota<V>(start, step);
+        const V ref_sin = apply_std(x, [](T a) { return std::sin(a); });
+        const V ref_cos = apply_std(x, [](T a) { return std::cos(a); });
+        FUZZY_COMPARE(Vc::sin(x), ref_sin) << "x = " << x;
+        FUZZY_COMPARE(Vc::cos(x), ref_cos) << "x = " << x;
+        V s, c;
+        Vc::sincos(x, &s, &c);
+        FUZZY_COMPARE(s, ref_sin) << "x = " << x;
+        FUZZY_COMPARE(c, ref_cos) << "x = " << x;
+    }
+    for (T start = T(-2); start < T(2); start += T(1) / 64) {
+        const V x = iota<V>(start, T(1) / 256);
+        FUZZY_COMPARE(Vc::sin(x), apply_std(x, [](T a) { return std::sin(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(Vc::cos(x), apply_std(x, [](T a) { return std::cos(a); }))
+            << "x = " << x;
+    }
+
+    using L = std::numeric_limits<T>;
+    for (T x : {L::infinity(), -L::infinity(), L::quiet_NaN()}) {
+        V s, c;
+        Vc::sincos(V(x), &s, &c);
+        VERIFY(all_of(Vc::sin(V(x)) != Vc::sin(V(x)))) << Vc::sin(V(x));
+        VERIFY(all_of(Vc::cos(V(x)) != Vc::cos(V(x)))) << Vc::cos(V(x));
+        VERIFY(all_of(s != s)) << s;
+        VERIFY(all_of(c != c)) << c;
+    }
+}
+
+TEST_TYPES(V, asin, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    for (T start = -1; start <= 1; start += T(1) / 512) {
+        V x = iota<V>(start, T(1) / 4096);
+        where(x > 1, x) = 1;
+        FUZZY_COMPARE(Vc::asin(x), apply_std(x, [](T a) { return std::asin(a); }))
+            << "x = " << x;
+    }
+    for (T x : {T(1.1), T(-1.1), T(2), std::numeric_limits<T>::infinity(),
+                std::numeric_limits<T>::quiet_NaN()}) {
+        const V r = Vc::asin(V(x));
+        VERIFY(all_of(r != r)) << r;
+    }
+}
+
+TEST_TYPES(V, atan, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    for (T start = -64; start < 64; start += T(1) / 16) {
+        const V x = iota<V>(start, T(1) / 128);
+        FUZZY_COMPARE(Vc::atan(x), apply_std(x, [](T a) { return std::atan(a); }))
+            << "x = " << x;
+    }
+    for (T x : special_values<T>()) {
+        FUZZY_COMPARE(Vc::atan(V(x)), V(std::atan(x))) << "x = " << x;
+    }
+}
+
+TEST_TYPES(V, atan2, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(3);
+    UnitTest::setFuzzyness<double>(2);
+
+    for (T y0 = -8; y0 < 8; y0 += T(1) / 4) {
+        for (T x0 = -8; x0 < 8; x0 += T(1) / 4) {
+            const V y = iota<V>(y0, T(1) / 64);
+            const V x = iota<V>(x0, T(-1) / 32);
+            FUZZY_COMPARE(Vc::atan2(y, x),
+                          apply_std(y, x, [](T a, T b) { return std::atan2(a, b); }))
+                << "y = " << y << ", x = " << x;
+        }
+    }
+    const auto special = special_values<T>();
+    for (T y : special) {
+        for (T x : special) {
+            FUZZY_COMPARE(Vc::atan2(V(y), V(x)), V(std::atan2(y, x)))
+                << "y = " << y << ", x = " << x;
+        }
+    }
+}
+
+TEST_TYPES(V, fma, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    using L = std::numeric_limits<T>;
+
+    const auto ref = [](const V &a, const V &b, const V &c) {
+        return V([&](auto i) { return std::fma(T(a[i]), T(b[i]), T(c[i])); });
+    };
+    std::mt19937 engine;
+    std::uniform_real_distribution<T> mantissa(1, 2);
+    std::uniform_int_distribution<int> exponent(-40, 40);
+    const auto random = [&]() {
+        return V([&](auto) {
+            return std::ldexp(mantissa(engine), exponent(engine)) *
+                   (engine() % 2 ? 1 : -1);
+        });
+    };
+    for (int repetition = 0; repetition < 10000; ++repetition) {
+        const V a = random();
+        const V b = random();
+        const V c = random();
+        COMPARE(Vc::fma(a, b, c), ref(a, b, c)) << "a = " << a << ", b = " << b
+                                                << ", c = " << c;
+        // c cancels the rounded product, so the result is the rounding error of a * b
+        const V p = -(a * b);
+        COMPARE(Vc::fma(a, b, p), ref(a, b, p)) << "a = " << a << ", b = " << b;
+        // the product is close to a tie between two neighbors of c
+        const V t = a * b * L::epsilon() / 2;
+        COMPARE(Vc::fma(a, b * L::epsilon() / 2, c), ref(a, b * L::epsilon() / 2, c))
+            << "a = " << a << ", b = " << b << ", c = " << c << ", t = " << t;
+    }
+    // factors and products at the ends of the exponent range: huge a with tiny b, products
+    // that overflow unless c cancels them, and products and sums that underflow
+    const int e_max = L::max_exponent - 1;
+    const int e_min = L::min_exponent - 1;
+    std::uniform_int_distribution<int> offset(-12, 0);
+    const auto around = [&](int e) {
+        return V([&](auto) {
+            return std::ldexp(mantissa(engine), e + offset(engine)) * (engine() % 2 ? 1 : -1);
+        });
+    };
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V huge = around(e_max);
+        const V tiny = around(6 - e_max);
+        const V c = random();
+        COMPARE(Vc::fma(huge, tiny, c), ref(huge, tiny, c))
+            << "a = " << huge << ", b = " << tiny << ", c = " << c;
+        const V a = around(e_max / 2 + 6);
+        const V b = around(e_max / 2 + 6);
+        const V cancel = -around(e_max);
+        COMPARE(Vc::fma(a, b, cancel), ref(a, b, cancel))
+            << "a = " << a << ", b = " << b << ", c = " << cancel;
+        const V x = around(e_min / 2);
+        const V y = around(e_min / 2 - 10);
+        const V z = around(e_min - 4);
+        COMPARE(Vc::fma(x, y, z), ref(x, y, z)) << "a = " << x << ", b = " << y << ", c = " << z;
+        const V w = -(x * y);
+        COMPARE(Vc::fma(x, y, w), ref(x, y, w)) << "a = " << x << ", b = " << y << ", c = " << w;
+    }
+
+    const auto special = special_values<T>();
+    for (T a : special) {
+        for (T b : special) {
+            for (T c : special) {
+                const V r = Vc::fma(V(a), V(b), V(c));
+                const T r_ref = std::fma(a, b, c);
+                if (std::isnan(r_ref)) {
+                    VERIFY(all_of(r != r)) << "a = " << a << ", b = " << b
+                                           << ", c = " << c << ", r = " << r;
+                } else {
+                    COMPARE(r, V(r_ref)) << "a = " << a << ", b = " << b << ", c = " << c;
+                }
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, exp, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    using L = std::numeric_limits<T>;
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(1);
+
+    const auto ref = [](T a) { return std::exp(a); };
+    for (T start = std::log(L::min()); start < std::log(L::max()) + 1; start += T(1) / 8) {
+        const V x = iota<V>(start, T(1) / 64);
+        FUZZY_COMPARE(Vc::exp(x), apply_std(x, ref)) << "x = " << x;
+    }
+    // denormal results have fewer significant bits, so only the absolute error is meaningful
+    for (T start = std::log(L::denorm_min()) - 1; start < std::log(L::min());
+         start += T(1) / 8) {
+        const V x = iota<V>(start, T(1) / 64);
+        const V r = Vc::exp(x);
+        VERIFY(all_of(abs(r - apply_std(x, ref)) <= L::denorm_min())) << "x = " << x
+                                                                        << ", r = " << r;
+    }
+    for (T x : special_values<T>()) {
+        FUZZY_COMPARE(Vc::exp(V(x)), V(std::exp(x))) << "x = " << x;
+    }
+    VERIFY(all_of(Vc::exp(V(L::quiet_NaN())) != Vc::exp(V(L::quiet_NaN()))));
+}
+
+TEST_TYPES(V, exp2, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    using L = std::numeric_limits<T>;
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(1);
+
+    const auto ref = [](T a) { return std::exp2(a); };
+    for (T start = L::min_exponent - 1; start < L::max_exponent + 1; start += T(1) / 8) {
+        const V x = iota<V>(start, T(1) / 64);
+        FUZZY_COMPARE(Vc::exp2(x), apply_std(x, ref)) << "x = " << x;
+    }
+    for (T start = L::min_exponent - L::digits - 2; start < L::min_exponent - 1;
+         start += T(1) / 8) {
+        const V x = iota<V>(start, T(1) / 64);
+        const V r = Vc::exp2(x);
+        VERIFY(all_of(abs(r - apply_std(x, ref)) <= L::denorm_min())) << "x = " << x
+                                                                        << ", r = " << r;
+    }
+    for (T x : special_values<T>()) {
+        FUZZY_COMPARE(Vc::exp2(V(x)), V(std::exp2(x))) << "x = " << x;
+    }
+    VERIFY(all_of(Vc::exp2(V(L::quiet_NaN())) != Vc::exp2(V(L::quiet_NaN()))));
+}
+
+// log_inputs {{{1
+// Positive inputs spanning the whole exponent range, including denormals, with a dense
+// sampling of the mantissa.
+template <class V, class F> void for_log_inputs(F &&f)
+{
+    using T = typename V::value_type;
+    using L = std::numeric_limits<T>;
+    for (T scale = L::denorm_min(); scale < L::max() / 2; scale *= T(1 << 5)) {
+        for (T start = 1; start < 2; start += T(1) / 64) {
+            f(iota<V>(start, T(1) / 4096) * scale);
+        }
+    }
+    for (T start = T(.5); start < T(1.5); start += T(1) / 64) {
+        f(iota<V>(start, T(1) / 8192));
+    }
+}
+
+template <class V, class F, class G> void test_log(F &&vc_fun, G &&std_fun)
+{
+    using T = typename V::value_type;
+    for_log_inputs<V>([&](const V &x) {
+        FUZZY_COMPARE(vc_fun(x), apply_std(x, std_fun)) << "x = " << x;
+    });
+    for (T x : special_values<T>()) {
+        const V r = vc_fun(V(x));
+        if (std::isnan(std_fun(x))) {
+            VERIFY(all_of(r != r)) << "x = " << x << ", r = " << r;
+        } else {
+            FUZZY_COMPARE(r, V(std_fun(x))) << "x = " << x;
+        }
+    }
+}
+
+TEST_TYPES(V, log, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(1);
+    test_log<V>([](const V &x) { return Vc::log(x); }, [](T x) { return std::log(x); });
+}
+
+TEST_TYPES(V, log2, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(1);
+    test_log<V>([](const V &x) { return Vc::log2(x); }, [](T x) { return std::log2(x); });
+}
+
+TEST_TYPES(V, log10, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+    test_log<V>([](const V &x) { return Vc::log10(x); }, [](T x) { return std::log10(x); });
+}
+
+TEST_TYPES(V, log1p, (real_test_types))  //{{{1
+{
+    using T = typename V::value_type;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    for (T start = T(-.999); start < 4; start += T(1) / 64) {
+        const V x = iota<V>(start, T(1) / 1024);
+        FUZZY_COMPARE(Vc::log1p(x), apply_std(x, [](T a) { return std::log1p(a); }))
+            << "x = " << x;
+    }
+    for (T scale = std::numeric_limits<T>::epsilon(); scale < 1; scale *= 2) {
+        const V x = iota<V>(scale, scale / 64);
+        FUZZY_COMPARE(Vc::log1p(x), apply_std(x, [](T a) { return std::log1p(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(Vc::log1p(-x), apply_std(-x, [](T a) { return std::log1p(a); }))
+            << "x = " << -x;
+    }
+    for (T x : special_values<T>()) {
+        const V r = Vc::log1p(V(x));
+        if (std::isnan(std::log1p(x))) {
+            VERIFY(all_of(r != r)) << "x = " << x << ", r = " << r;
+        } else {
+            FUZZY_COMPARE(r, V(std::log1p(x))) << "x = " << x;
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,314 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#define WITH_DATAPAR 1
+//#define UNITTEST_ONLY_XTEST 1
+#include "unittest.h"
+#include <Vc/datapar>
+#include <Vc/simdize>
+
+template <class... Ts> using base_template = Vc::datapar<Ts...>;
+#include "testtypes.h"
+
+template <class T> struct PointTemplate {
+    T x, y, z;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+
+    PointTemplate() = default;
+    PointTemplate(T xx, T yy, T zz) : x{xx}, y{yy}, z{zz} {}
+
+    T sum() const { return x + y + z; }
+};
+
+TEST(type_mapping) //{{{1
+{
+    using Vc::simdize;
+    using Vc::native_datapar;
+    using Vc::native_mask;
+    using float4 = Vc::datapar<float, Vc::abi_for_size_t<float, 4>>;
+    using int4 = Vc::datapar<int, Vc::abi_for_size_t<int, 4>>;
+    COMPARE(typeid(simdize<float>), typeid(native_datapar<float>));
+    COMPARE(typeid(simdize<int, 4>), typeid(int4));
+    COMPARE(typeid(simdize<bool>), typeid(native_mask<float>));
+    COMPARE(typeid(simdize<bool, 4, int>), typeid(Vc::mask<int, int4::abi_type>));
+    COMPARE(typeid(simdize<float4>), typeid(float4));
+    COMPARE(typeid(simdize<std::tuple<int *, std::nullptr_t>>),
+            typeid(std::tuple<int *, std::nullptr_t>));
+
+    // the first vectorized member determines the size of all members
+    using T0 = simdize<std::tuple<int *, float, double, bool>>;
+    COMPARE(T0::size(), native_datapar<float>::size());
+    COMPARE(typeid(T0::base_type),
+            typeid(std::tuple<int *, native_datapar<float>,
+                              Vc::datapar<double, Vc::abi_for_size_t<
+                                                      double, native_datapar<float>::size()>>,
+                              Vc::mask<float, Vc::datapar_abi::native<float>>>));
+    COMPARE(typeid(T0::scalar_type), typeid(std::tuple<int *, float, double, bool>));
+    COMPARE(std::tuple_size<T0>::value, 4u);
+    COMPARE(typeid(std::tuple_element_t<1, T0>), typeid(native_datapar<float>));
+
+    using T1 = simdize<std::array<PointTemplate<short>, 2>, 4>;
+    COMPARE(T1::size(), 4u);
+    COMPARE(typeid(T1::base_type::value_type),
+            typeid(simdize<PointTemplate<short>, 4>));
+    COMPARE(typeid(T1::base_type::value_type::base_type),
+            typeid(PointTemplate<Vc::datapar<short, Vc::abi_for_size_t<short, 4>>>));
+}
+
+TEST_TYPES(V, broadcast_assign_extract, (all_test_types)) //{{{1
+{
+    using T = typename V::value_type;
+    using S = PointTemplate<T>;
+    using A = Vc::simdize<S, V::size()>;
+    COMPARE(A::size(), V::size());
+
+    A a = S{T(1), T(2), T(3)};
+    COMPARE(a.x, V(T(1)));
+    COMPARE(a.y, V(T(2)));
+    COMPARE(a.z, V(T(3)));
+    COMPARE(a.sum(), V(T(6)));
+
+    for (size_t i = 0; i < A::size(); ++i) {
+        Vc::assign(a, i, S{T(i), T(i + 1), T(i + 2)});
+    }
+    const V ref([](T i) { return i; });
+    COMPARE(a.x, ref);
+    COMPARE(a.y, ref + T(1));
+    COMPARE(a.z, ref + T(2));
+    for (size_t i = 0; i < A::size(); ++i) {
+        const S s = Vc::extract(a, i);
+        COMPARE(s.x, T(i));
+        COMPARE(s.y, T(i + 1));
+        COMPARE(s.z, T(i + 2));
+        const S s2 = Vc::decorate(a)[i];
+        COMPARE(s2.z, T(i + 2));
+    }
+    Vc::decorate(a)[0] = S{T(7), T(8), T(9)};
+    COMPARE(a.x[0], T(7));
+    COMPARE(a.y[0], T(8));
+    COMPARE(a.z[0], T(9));
+
+    using TA = Vc::simdize<std::tuple<T, bool>, V::size()>;
+    TA t = std::tuple<T, bool>{T(3), true};
+    COMPARE(std::get<0>(t), V(T(3)));
+    VERIFY(all_of(std::get<1>(t)));
+    Vc::assign(t, 0, std::tuple<T, bool>{T(1), false});
+    COMPARE(std::get<0>(Vc::extract(t, 0)), T(1));
+    COMPARE(std::get<1>(Vc::extract(t, 0)), false);
+    COMPARE(std::get<1>(Vc::extract(t, 1 % V::size())), V::size() > 1);
+}
+
+TEST_TYPES(V, load_store_gather_scatter, (all_test_types)) //{{{1
+{
+    using T = typename V::value_type;
+    using I = Vc::datapar<int, Vc::abi_for_size_t<int, V::size()>>;
+    constexpr size_t N = 3 * V::size() + 1;
+
+    // PointTemplate<T> is contiguous and uses interleaved_load & co.
+    {
+        using S = PointTemplate<T>;
+        using A = Vc::simdize<S, V::size()>;
+        S mem[N];
+        for (size_t i = 0; i < N; ++i) {
+            mem[i] = S{T(3 * i), T(3 * i + 1), T(3 * i + 2)};
+        }
+        const V ref([](T i) { return i; });
+        for (size_t offset = 0; offset + V::size() <= N; ++offset) {
+            A a(&mem[offset]);
+            COMPARE(a.x, (ref + T(offset)) * T(3)) << "offset: " << offset;
+            COMPARE(a.y, (ref + T(offset)) * T(3) + T(1)) << "offset: " << offset;
+            COMPARE(a.z, (ref + T(offset)) * T(3) + T(2)) << "offset: " << offset;
+        }
+
+        A a(&mem[0]);
+        a.x += T(1);
+        S out[N] = {};
+        a.memstore(&out[1]);
+        COMPARE(out[0].x, T(0));
+        for (size_t i = 0; i < V::size(); ++i) {
+            COMPARE(out[i + 1].x, T(3 * i + 1));
+            COMPARE(out[i + 1].y, T(3 * i + 1));
+            COMPARE(out[i + 1].z, T(3 * i + 2));
+        }
+
+        const I idx([](int i) { return (i * 2) % int(N); });
+        A g(mem, idx);
+        for (size_t i = 0; i < V::size(); ++i) {
+            COMPARE(g.x[i], mem[idx[i]].x);
+            COMPARE(g.z[i], mem[idx[i]].z);
+        }
+        S out2[N] = {};
+        const I idx2([](int i) { return int(N) - 1 - i; });
+        g.scatter(out2, idx2);
+        for (size_t i = 0; i < V::size(); ++i) {
+            COMPARE(out2[idx2[i]].x, mem[idx[i]].x);
+            COMPARE(out2[idx2[i]].y, mem[idx[i]].y);
+            COMPARE(out2[idx2[i]].z, mem[idx[i]].z);
+        }
+    }
+
+    // a tuple with a bool member uses the generic implementation
+    {
+        using S = std::tuple<T, bool>;
+        using A = Vc::simdize<S, V::size()>;
+        S mem[N];
+        for (size_t i = 0; i < N; ++i) {
+            mem[i] = S{T(i), i % 3 == 0};
+        }
+        A a(&mem[1]);
+        for (size_t i = 0; i < V::size(); ++i) {
+            COMPARE(std::get<0>(a)[i], T(i + 1));
+            COMPARE(std::get<1>(a)[i], (i + 1) % 3 == 0);
+        }
+        S out[N];
+        a.memstore(out);
+        for (size_t i = 0; i < V::size(); ++i) {
+            COMPARE(std::get<0>(out[i]), T(i + 1));
+            COMPARE(std::get<1>(out[i]), (i + 1) % 3 == 0);
+        }
+        const I idx([](int i) { return int(N) - 1 - i; });
+        a.gather(mem, idx);
+        for (size_t i = 0; i < V::size(); ++i) {
+            COMPARE(std::get<0>(a)[i], T(N - 1 - i));
+        }
+    }
+}
+
+TEST_TYPES(V, where, (all_test_types)) //{{{1
+{
+    using T = typename V::value_type;
+    using S = PointTemplate<T>;
+    using A = Vc::simdize<S, V::size()>;
+    using M = typename V::mask_type;
+
+    A a = S{T(1), T(2), T(3)};
+    const A b = S{T(4), T(5), T(6)};
+    const M k = V([](int i) { return T(i % 2); }) == V(T(0));
+    where(k, a) = b;
+    for (size_t i = 0; i < V::size(); ++i) {
+        COMPARE(a.x[i], T(i % 2 == 0 ? 4 : 1));
+        COMPARE(a.y[i], T(i % 2 == 0 ? 5 : 2));
+        COMPARE(a.z[i], T(i % 2 == 0 ? 6 : 3));
+    }
+    where(!k, a) = S{T(7), T(8), T(9)};
+    for (size_t i = 0; i < V::size(); ++i) {
+        COMPARE(a.x[i], T(k[i] ? 4 : 7));
+        COMPARE(a.y[i], T(k[i] ? 5 : 8));
+        COMPARE(a.z[i], T(k[i] ? 6 : 9));
+    }
+
+    // masks of a different type and nested bool members
+    using TA = Vc::simdize<std::tuple<T, bool>, V::size()>;
+    TA t = std::tuple<T, bool>{T(1), false};
+    using FV = Vc::datapar<float, Vc::abi_for_size_t<float, V::size()>>;
+    const auto kf = FV([](int i) { return float(i); }) == FV(0.f);
+    where(kf, t) = std::tuple<T, bool>{T(2), true};
+    COMPARE(std::get<0>(t)[0], T(2));
+    COMPARE(std::get<1>(t)[0], true);
+    for (size_t i = 1; i < V::size(); ++i) {
+        COMPARE(std::get<0>(t)[i], T(1));
+        COMPARE(std::get<1>(t)[i], false);
+    }
+
+    S mem[V::size()];
+    for (size_t i = 0; i < V::size(); ++i) {
+        mem[i] = S{T(10), T(11), T(12)};
+    }
+    where(k, a).memload(mem);
+    for (size_t i = 0; i < V::size(); ++i) {
+        COMPARE(a.x[i], T(k[i] ? 10 : 7));
+        COMPARE(a.z[i], T(k[i] ? 12 : 9));
+    }
+}
+
+TEST_TYPES(V, soa_vector, (all_test_types)) //{{{1
+{
+    using T = typename V::value_type;
+    using S = PointTemplate<T>;
+    using C = Vc::soa_vector<S, V::size()>;
+    COMPARE(typeid(typename C::datapar_type), typeid(Vc::simdize<S, V::size()>));
+    COMPARE(C::datapar_size(), V::size());
+    constexpr size_t N = 3 * V::size() + 1;
+
+    C v;
+    for (size_t i = 0; i < N; ++i) {
+        v.push_back(S{T(i), T(i + 1), T(i + 2)});
+        COMPARE(reinterpret_cast<std::uintptr_t>(v.template data<0>()) % alignof(V), 0u);
+        COMPARE(reinterpret_cast<std::uintptr_t>(v.template data<2>()) % alignof(V), 0u);
+    }
+    COMPARE(v.size(), N);
+    COMPARE(v.capacity() % V::size(), 0u);
+    for (size_t i = 0; i < N; ++i) {
+        const S s = v[i];
+        COMPARE(s.x, T(i));
+        COMPARE(s.z, T(i + 2));
+        COMPARE(S(v[i]).sum(), T(3 * i + 3));
+    }
+
+    // the proxy writes through to the arrays
+    v[1].y = T(10);
+    COMPARE(v.template data<1>()[1], T(10));
+    v[2] = S{T(7), T(8), T(9)};
+    COMPARE(static_cast<const C &>(v)[2].y, T(8));
+    v[0] = v[2];
+    COMPARE(v.template data<0>()[0], T(7));
+
+    // datapar-sized steps
+    for (size_t i = 0; i < v.size(); i += v.datapar_size()) {
+        auto x = v.load(i);
+        x.x += T(1);
+        v.store(i, x);
+    }
+    COMPARE(v[3].x, T(4));
+    COMPARE(v[N - 1].x, T(N));
+    COMPARE(v[N - 1].y, T(N));
+
+    // growing keeps the entries and the alignment
+    const C copy = v;
+    v.resize(5 * N, S{T(1), T(2), T(3)});
+    COMPARE(reinterpret_cast<std::uintptr_t>(v.template data<1>()) % alignof(V), 0u);
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(v[i].x, copy[i].x);
+        COMPARE(v[i].y, copy[i].y);
+        COMPARE(v[i].z, copy[i].z);
+    }
+    for (size_t i = N; i < v.size(); ++i) {
+        COMPARE(S(v[i]).sum(), T(6));
+    }
+    v.resize(2);
+    COMPARE(v.size(), 2u);
+    COMPARE(v.load(0).x[1 % V::size()], copy[1 % V::size()].x);
+
+    // members of different types
+    Vc::soa_vector<std::tuple<T, int>, V::size()> t(N, std::tuple<T, int>{T(1), 2});
+    std::get<1>(t[N - 1]) = 5;
+    COMPARE(std::get<1>(t.load((N - 1) / V::size() * V::size()))[(N - 1) % V::size()], 5);
+    COMPARE(std::get<0>(static_cast<std::tuple<T, int>>(t[0])), T(1));
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,51 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2017 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#define WITH_DATAPAR 1
+#include "unittest.h"
+#include <Vc/datapar>
+
+TEST(dispatch)  //{{{1
+{
+    using Vc::dispatch_target;
+    // the test runs, thus the CPU supports the target it was compiled for
+    VERIFY(int(Vc::best_dispatch_target()) >= int(Vc::current_dispatch_target));
+
+    Vc::dispatched<int(int)> f;
+    f.add<dispatch_target::scalar>([](int x) { return x; });
+    f.add([](int x) { return x + 1; });
+    COMPARE(int(f.selected_target()), int(Vc::current_dispatch_target));
+    COMPARE(f(1), Vc::current_dispatch_target == dispatch_target::scalar ? 1 : 2);
+    if (Vc::best_dispatch_target() != dispatch_target::avx512) {
+        // implementations the CPU cannot execute are never selected
+        f.add<dispatch_target::avx512>([](int) { return -1; });
+        COMPARE(int(f.selected_target()), int(Vc::current_dispatch_target));
+        COMPARE(f(1), Vc::current_dispatch_target == dispatch_target::scalar ? 1 : 2);
+    }
+}
+
+// vim: foldmethod=marker
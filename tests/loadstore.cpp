@@ -327,3 +327,119 @@ TEST_TYPES(VU, load_store,
     }
 }
 
+
+// gathers & scatters {{{1
+template <class V, class IV> void test_gather_scatter()
+{
+    using T = typename V::value_type;
+    using M = typename V::mask_type;
+    using I = typename IV::value_type;
+    constexpr std::size_t N = V::size();
+    const M alternating_mask = make_mask<M>({0, 1});
+
+    T mem[3 * N] = {};
+    for (std::size_t i = 0; i < 3 * N; ++i) {
+        mem[i] = T(i + 1);
+    }
+    // reversed with a stride of 3 and an offset of 1
+    const IV idx([](auto i) { return I(3 * (N - 1 - i) + 1); });
+
+    V x(mem, idx);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(x[i], mem[3 * (N - 1 - i) + 1]) << "i: " << i;
+    }
+    x = 0;
+    x.gather(mem, idx);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(x[i], mem[3 * (N - 1 - i) + 1]) << "i: " << i;
+    }
+
+    x = 0;
+    where(alternating_mask, x).gather(mem, idx);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(x[i], alternating_mask[i] ? mem[3 * (N - 1 - i) + 1] : T(0))
+            << "i: " << i;
+    }
+    x = where(!alternating_mask, V(T(1))).gather(mem, idx);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(x[i], alternating_mask[i] ? T(1) : mem[3 * (N - 1 - i) + 1])
+            << "i: " << i;
+    }
+
+    const V values([](auto i) { return T(i + 1); });
+    T out[3 * N] = {};
+    values.scatter(out, idx);
+    for (std::size_t i = 0; i < 3 * N; ++i) {
+        COMPARE(out[i], i % 3 == 1 ? T(N - (i - 1) / 3) : T(0)) << "i: " << i;
+    }
+
+    for (auto &o : out) {
+        o = T(0);
+    }
+    where(alternating_mask, values).scatter(out, idx);
+    for (std::size_t i = 0; i < 3 * N; ++i) {
+        const std::size_t lane = N - 1 - (i - 1) / 3;
+        COMPARE(out[i], i % 3 == 1 && alternating_mask[lane] ? values[lane] : T(0))
+            << "i: " << i;
+    }
+}
+
+TEST_TYPES(V, gather_scatter, (all_test_types))
+{
+    constexpr std::size_t N = V::size();
+    test_gather_scatter<V, Vc::datapar<int, Vc::abi_for_size_t<int, N>>>();
+    test_gather_scatter<V, Vc::datapar<llong, Vc::abi_for_size_t<llong, N>>>();
+    test_gather_scatter<V, Vc::fixed_size_datapar<ushort, N>>();
+}
+
+// interleaved loads & stores {{{1
+template <class V, std::size_t... Member> void test_interleaved(std::index_sequence<Member...>)
+{
+    using T = typename V::value_type;
+    using IV = Vc::datapar<int, Vc::abi_for_size_t<int, V::size()>>;
+    constexpr std::size_t N = V::size();
+    constexpr std::size_t M = sizeof...(Member);
+
+    T mem[M * N];
+    for (std::size_t i = 0; i < M * N; ++i) {
+        mem[i] = T(i % 101 + 1);
+    }
+
+    std::array<V, M> v;
+    Vc::interleaved_load(mem, v[Member]...);
+    for (std::size_t m = 0; m < M; ++m) {
+        for (std::size_t i = 0; i < N; ++i) {
+            COMPARE(v[m][i], mem[i * M + m]) << "M: " << M << ", m: " << m << ", i: " << i;
+        }
+    }
+    T out[M * N] = {};
+    Vc::interleaved_store(out, v[Member]...);
+    for (std::size_t i = 0; i < M * N; ++i) {
+        COMPARE(out[i], mem[i]) << "M: " << M << ", i: " << i;
+    }
+
+    // structures in reversed order
+    const IV idx([](auto i) { return int(N - 1 - i); });
+    Vc::interleaved_gather(mem, idx, v[Member]...);
+    for (std::size_t m = 0; m < M; ++m) {
+        for (std::size_t i = 0; i < N; ++i) {
+            COMPARE(v[m][i], mem[(N - 1 - i) * M + m])
+                << "M: " << M << ", m: " << m << ", i: " << i;
+        }
+    }
+    for (auto &o : out) {
+        o = T(0);
+    }
+    Vc::interleaved_scatter(out, idx, v[Member]...);
+    for (std::size_t i = 0; i < M * N; ++i) {
+        COMPARE(out[i], mem[i]) << "M: " << M << ", i: " << i;
+    }
+}
+
+TEST_TYPES(V, interleaved_load_store, (all_test_types))
+{
+    test_interleaved<V>(std::make_index_sequence<2>());
+    test_interleaved<V>(std::make_index_sequence<3>());
+    test_interleaved<V>(std::make_index_sequence<4>());
+    test_interleaved<V>(std::make_index_sequence<5>());
+}
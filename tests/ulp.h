@@ -67,44 +67,24 @@ inline T ulpDiffToReferenceSigned(T val, T ref)
     return ulpDiffToReference(val, ref) * (val - ref < 0 ? -1 : 1);
 }
 
-template <typename V, typename = Vc::enable_if<Vc::is_datapar<V>::value>>
-static V ulpDiffToReference(const V &_val, const V &_ref)
+template <typename T, typename A>
+static Vc::enable_if<std::is_floating_point<T>::value, Vc::datapar<T, A>> ulpDiffToReference(
+    const Vc::datapar<T, A> &val, const Vc::datapar<T, A> &ref)
 {
-    using namespace Vc;
-    using T = typename V::EntryType;
-    using M = typename V::Mask;
-
-    V val = _val;
-    V ref = _ref;
-
-    V diff = V::Zero();
-
-    M zeroMask = ref == V::Zero();
-    val  (zeroMask)= abs(val);
-    ref  (zeroMask)= std::numeric_limits<V>::min();
-    diff (zeroMask)= V::One();
-    zeroMask = val == V::Zero();
-    ref  (zeroMask)= abs(ref);
-    val  (zeroMask)= std::numeric_limits<V>::min();
-    diff (zeroMask)+= V::One();
-
-    typename V::IndexType exp;
-    frexp(ref, &exp);
-    diff += ldexp(abs(ref - val), std::numeric_limits<T>::digits - exp);
-    diff.setZero(_val == _ref || (isnan(_val) && isnan(_ref)));
-    return diff;
+    return Vc::datapar<T, A>([&](auto i) { return ulpDiffToReference(T(val[i]), T(ref[i])); });
 }
 
 template <typename T, typename A>
-inline Vc::enable_if<std::is_floating_point<T>::value, T> ulpDiffToReferenceSigned(
-    const Vc::datapar<T, A> &_val, const Vc::datapar<T, A> &_ref)
+inline Vc::enable_if<std::is_floating_point<T>::value, Vc::datapar<T, A>>
+ulpDiffToReferenceSigned(const Vc::datapar<T, A> &val, const Vc::datapar<T, A> &ref)
 {
-    return copysign(ulpDiffToReference(_val, _ref), _val - _ref);
+    return Vc::datapar<T, A>(
+        [&](auto i) { return ulpDiffToReferenceSigned(T(val[i]), T(ref[i])); });
 }
 
 template <typename T, typename A>
-inline Vc::enable_if<!std::is_floating_point<T>::value, T> ulpDiffToReferenceSigned(
-    const Vc::datapar<T, A> &, const Vc::datapar<T, A> &)
+inline Vc::enable_if<!std::is_floating_point<T>::value, Vc::datapar<T, A>>
+ulpDiffToReferenceSigned(const Vc::datapar<T, A> &, const Vc::datapar<T, A> &)
 {
     return 0;
 }
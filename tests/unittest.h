@@ -299,6 +299,7 @@ public:
         , expect_assert_failure(false)
         , float_fuzzyness(1.f)
         , double_fuzzyness(1.)
+        , ldouble_fuzzyness(1.L)
         , only_name(0)
         , m_finalized(false)
         , failedTests(0)
@@ -332,6 +333,7 @@ public:
     bool expect_assert_failure;
     float float_fuzzyness;
     double double_fuzzyness;
+    long double ldouble_fuzzyness;
     const char *only_name;
     bool vim_lines = false;
     std::fstream plotFile;
@@ -352,6 +354,7 @@ public:
 };
 template <> float &UnitTester::fuzzyness<float>() { return float_fuzzyness; }
 template <> double &UnitTester::fuzzyness<double>() { return double_fuzzyness; }
+template <> long double &UnitTester::fuzzyness<long double>() { return ldouble_fuzzyness; }
 
 static UnitTester global_unit_test_object_;
 
@@ -414,6 +417,7 @@ void UnitTester::runTestInt(TestFunction fun, const char *name)  //{{{1
     {
         setFuzzyness<float>(1);
         setFuzzyness<double>(1);
+        setFuzzyness<long double>(1);
         maximumDistance = 0.;
         meanDistance = 0.;
         meanCount = 0;
@@ -496,7 +500,7 @@ Vc_ALWAYS_INLINE bool unittest_compareHelper<std::type_info, std::type_info>(
 namespace detail
 {
 using std::abs;
-template <typename T, typename U = decltype(abs(Vc::declval<const T &>()))>
+template <typename T, typename = Vc::enable_if<std::is_arithmetic<T>::value>>
 T ulpDiffToReferenceWrapper(T a, T b, int)
 {
     const T diff = ulpDiffToReference(a, b);
@@ -515,7 +519,8 @@ T ulpDiffToReferenceWrapper(const T a, const T b, float)
 {
     T diff;
     for (size_t i = 0; i < a.size(); ++i) {
-        diff[i] = ulpDiffToReference(a[i], b[i]);
+        using U = value_type_or_T<T>;
+        diff[i] = ulpDiffToReferenceWrapper(U(a[i]), U(b[i]), int());
     }
     return diff;
 }
@@ -1081,7 +1086,7 @@ template <typename T> inline void Compare::printFuzzyInfo(T a, T b)
 template <typename T>
 static inline void writePlotDataImpl(std::true_type, std::fstream &file, T ref, T dist)
 {
-    for (size_t i = 0; i < T::Size; ++i) {
+    for (size_t i = 0; i < T::size(); ++i) {
         file << std::setprecision(12) << ref[i] << "\t" << dist[i] << "\n";
     }
 }
@@ -1251,7 +1256,7 @@ struct Test : public TestWrapper
     static void wrapper()
     {
         try {
-            TestWrapper::test_function();
+            TestWrapper::run();
         } catch (const Exception &e) {
             return;
         }